@@ -0,0 +1,1339 @@
+#include <array>
+#include <algorithm>
+#include <string>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <thread>
+#include <stdexcept>
+#include <type_traits>
+#include <string_view>
+#include <cerberus/analyzation/lex/lex.hpp>
+#include <cerberus/analyzation/lex/driver.hpp>
+#include <cerberus/analyzation/lex/stream.hpp>
+#include <cerberus/analyzation/lex/number.hpp>
+#include <cerberus/analyzation/lex/incremental.hpp>
+#include <cerberus/analyzation/lex/simd.hpp>
+
+using namespace cerb::literals;
+using namespace std::string_literals;
+
+enum struct TestToken : size_t
+{
+    EoF        = 0,
+    ADD        = 1,
+    ASSIGN     = 2,
+    SEPARATOR  = 3,
+    ADD_EQ     = 4,
+    FOR        = 5,
+    INTEGER    = 6,
+    IDENTIFIER = 7,
+    STRING     = 8,
+    CHAR       = 9,
+    FLOAT      = 10,
+    DOUBLE     = 11
+};
+
+struct TestLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    TestLexer()
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            { { FOR, "for"_sv, true, 2 },
+              { INTEGER, "[0-9]+"_sv, false, 13 },
+              { IDENTIFIER, "[a-zA-Z_]+[a-zA-Z0-9_]*"_sv, false, 13 } },
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } },
+              { { ADD_EQ, "+="_sv } } },
+            "//", "/*", "*/")
+    {}
+};
+
+// the same rules, declared as cerb2lex declares lexers
+template<
+    typename CharT = char, typename TokenType = TestToken, bool MayThrow = true,
+    size_t UID = 0, bool AllowStringLiterals = true, bool AllowComments = true,
+    size_t MaxTerminals = 128, size_t MaxSize4Terminals = 4, bool TrackPositions = true>
+struct GeneratedLexer : public CERBERUS_LEX_PARENT_CLASS
+{
+    CERBERUS_LEX_PARENT_CLASS_ACCESS
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    GeneratedLexer()
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            { { FOR, "for"_sv, true, 2 },
+              { INTEGER, "[0-9]+"_sv, false, 13 },
+              { IDENTIFIER, "[a-zA-Z_]+[a-zA-Z0-9_]*"_sv, false, 13 } },
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } },
+              { { ADD_EQ, "+="_sv } } },
+            "//", "/*", "*/")
+    {}
+};
+
+// identifiers may contain dots, their priority is set by test
+struct WordLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    explicit WordLexer(u32 identifier_priority)
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            { { FOR, "for"_sv, true, 2 },
+              { IDENTIFIER, "[a-z]+[.a-z]*"_sv, false, identifier_priority } },
+            { { { ASSIGN, '=' }, { SEPARATOR, ';' } }, {} }, "//", "/*", "*/")
+    {}
+};
+
+// keywords are hashed at compile time, like cerb2lex generates them
+struct HashedLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using keyword_set_t = typename parent::keyword_set_t;
+    using enum TestToken;
+
+    static constexpr keyword_set_t keywords{ { "for"_sv, FOR, 2 } };
+
+    static_assert(keywords.find("for"_sv) != nullptr);
+    static_assert(keywords.find("format"_sv) == nullptr);
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    HashedLexer()
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            { { INTEGER, "[0-9]+"_sv, false, 13 },
+              { IDENTIFIER, "[a-zA-Z_]+[a-zA-Z0-9_]*"_sv, false, 13 } },
+            keywords,
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } },
+              { { ADD_EQ, "+="_sv } } },
+            "//", "/*", "*/")
+    {}
+};
+
+// one class of characters, rules and input are decoded as the test says
+struct ClassLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    ClassLexer(const char *rule, cerb::lex::Encoding encoding)
+      : parent(
+            '\"', '\'', STRING, CHAR, { { IDENTIFIER, rule, false, 13 } },
+            { { { ASSIGN, '=' }, { SEPARATOR, ';' } }, {} }, "//", "/*", "*/",
+            encoding)
+    {}
+};
+
+// numbers, like C lexer has them: float may stop before its suffix
+struct FloatLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    FloatLexer()
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            { { INTEGER, "[0-9]+"_sv, false, 13 },
+              { FLOAT, "[0-9]+[.][0-9]*[f]"_sv, false, 13 },
+              { DOUBLE, "[0-9]+[.][0-9]*"_sv, false, 13 } },
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } }, {} }, "//",
+            "/*", "*/")
+    {}
+};
+
+// items begin with optional ranges, so they are candidates for several chars
+struct DispatchLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    DispatchLexer()
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            { { FOR, "for"_sv, true, 2 },
+              { FLOAT, "[0-9]*[.][0-9]+"_sv, false, 1 },
+              { INTEGER, "[~]?[0-9]+"_sv, false, 13 },
+              { IDENTIFIER, "[_]*[a-z]+[0-9]*"_sv, false, 13 } },
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } },
+              { { ADD_EQ, "+="_sv } } },
+            "//", "/*", "*/")
+    {}
+};
+
+// the same rules in priority order and shuffled, items are sorted by priority
+template<bool Shuffled>
+struct PriorityLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    CERBLIB_DECL auto item_order() const -> std::vector<std::pair<size_t, TestToken>>
+    {
+        std::vector<std::pair<size_t, TestToken>> result{};
+
+        for (const auto &item : m_items) {
+            result.emplace_back(item.priority, item.get_type());
+        }
+
+        return result;
+    }
+
+    // identifier with digits has the same priority and type: it is dropped
+    PriorityLexer()
+      : parent(
+            '\"', '\'', STRING, CHAR,
+            Shuffled ? std::initializer_list<const item_initializer>{
+                           { FLOAT, "[0-9]+[.][0-9]+"_sv, false, 20 },
+                           { IDENTIFIER, "[a-z]+"_sv, false, 13 },
+                           { IDENTIFIER, "[a-z]+[0-9]+"_sv, false, 13 },
+                           { INTEGER, "[0-9]+"_sv, false, 13 },
+                           { FOR, "for"_sv, true, 2 } }
+                     : std::initializer_list<const item_initializer>{
+                           { FOR, "for"_sv, true, 2 },
+                           { INTEGER, "[0-9]+"_sv, false, 13 },
+                           { IDENTIFIER, "[a-z]+"_sv, false, 13 },
+                           { IDENTIFIER, "[a-z]+[0-9]+"_sv, false, 13 },
+                           { FLOAT, "[0-9]+[.][0-9]+"_sv, false, 20 } },
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } }, {} }, "//",
+            "/*", "*/")
+    {}
+};
+
+// lexer with precomputed tables, like cerb2lex -DFA generates
+struct TableLexer : public cerb::lex::LexicalAnalyzer<char, TestToken>
+{
+    using parent = cerb::lex::LexicalAnalyzer<char, TestToken>;
+    using enum TestToken;
+
+    void error(const item_t & /*item*/, const string_view_t &repr) override
+    {
+        throw std::runtime_error("Unknown token: "s + std::string(repr.to_string()));
+    }
+
+    explicit TableLexer(const cerb::lex::Dfa<TestToken> &dfa)
+      : parent(
+            '\"', '\'', STRING, CHAR, dfa,
+            { { { ADD, '+' }, { ASSIGN, '=' }, { SEPARATOR, ';' } },
+              { { ADD_EQ, "+="_sv } } },
+            "//", "/*", "*/")
+    {}
+};
+
+struct Lexed
+{
+    std::vector<TestToken> types{};
+    std::vector<std::string> reprs{};
+    std::vector<size_t> columns{};
+    std::vector<size_t> diagnostics{};// offsets of errors
+    std::vector<size_t> diagnostic_columns{};
+    std::vector<size_t> diagnostic_lengths{};
+
+    auto operator==(const Lexed &) const -> bool = default;
+};
+
+// tokens are recorded by yield, scanning stops after the limit
+struct RecordingLexer : public TestLexer
+{
+    Lexed lexed{};
+    std::vector<size_t> batches{};
+    size_t limit{ std::numeric_limits<size_t>::max() };
+    bool finished{ false };
+
+    bool yield(const token_t &token) override
+    {
+        lexed.types.push_back(token.type);
+        lexed.reprs.emplace_back(token.repr.to_string());
+        lexed.columns.push_back(token.pos.char_number);
+        return lexed.types.size() < limit;
+    }
+
+    bool yield_batch(std::span<const token_t> tokens) override
+    {
+        batches.push_back(tokens.size());
+        return parent::yield_batch(tokens);
+    }
+
+    void finish() override
+    {
+        finished = true;
+    }
+};
+
+static auto expect(bool condition, const std::string &what, size_t line) -> void
+{
+    if (!condition) {
+        throw std::runtime_error(
+            "Check failed: "s + what + " at "s + std::string(__FILE__) + " "s +
+            std::to_string(line));
+    }
+}
+
+#define EXPECT(condition) expect(condition, #condition, __LINE__)
+
+template<typename Lexer = TestLexer, typename... Ts>
+static auto lex(const char *input, bool compile_dfa, Ts... args) -> Lexed
+{
+    Lexed result{};
+    Lexer lexer{ args... };
+
+    if (compile_dfa) {
+        lexer.compile_dfa();
+    }
+
+    lexer.recover_errors(true);
+
+    for (const auto &token : lexer.tokens(input, "test")) {
+        result.types.push_back(token.type);
+        result.reprs.emplace_back(token.repr.to_string());
+        result.columns.push_back(token.pos.char_number);
+    }
+
+    for (const auto &diagnostic : lexer.diagnostics()) {
+        result.diagnostics.push_back(diagnostic.offset);
+        result.diagnostic_columns.push_back(diagnostic.pos.char_number);
+        result.diagnostic_lengths.push_back(diagnostic.length);
+    }
+
+    return result;
+}
+
+// malformed numbers are rejected by items and by the compiled DFA alike
+static auto test_token_end() -> void
+{
+    using enum TestToken;
+
+    for (const char *input :
+         { "12abc + 3", "0x1F;", "a = 12abc;", "for12 = forx + for;", "1+=2 //c" }) {
+        EXPECT(lex(input, false) == lex(input, true));
+    }
+
+    Lexed malformed = lex("12abc + 3", true);
+    EXPECT((malformed.types == std::vector{ ADD, INTEGER, EoF }));
+    EXPECT((malformed.diagnostics == std::vector<size_t>{ 0 }));
+
+    Lexed hexadecimal = lex("0x1F;", true);
+    EXPECT((hexadecimal.types == std::vector{ SEPARATOR, EoF }));
+
+    Lexed valid = lex("for12 = forx + for;", true);
+    EXPECT((valid.types ==
+            std::vector{ IDENTIFIER, ASSIGN, IDENTIFIER, ADD, FOR, SEPARATOR, EoF }));
+    EXPECT(valid.diagnostics.empty());
+
+    // before layout float stops without its suffix, before terminal it can't
+    for (const char *input : { "1.5 ;", "3. ;", "1.5;", "3.;", "2.5f;", "2.5f ;",
+                               "7 ;", "7;", "1.5", "3.//c", "4.2/*c*/+1.5f" }) {
+        EXPECT(lex<FloatLexer>(input, false) == lex<FloatLexer>(input, true));
+    }
+
+    for (bool compile_dfa : { false, true }) {
+        EXPECT((lex<FloatLexer>("1.5 ; 3. ;", compile_dfa).types ==
+                std::vector{ FLOAT, SEPARATOR, FLOAT, SEPARATOR, EoF }));
+        EXPECT((lex<FloatLexer>("1.5;3.;2.5f;7;", compile_dfa).types ==
+                std::vector{ DOUBLE, SEPARATOR, DOUBLE, SEPARATOR, FLOAT, SEPARATOR,
+                             INTEGER, SEPARATOR, EoF }));
+    }
+}
+
+// failed matches don't move the position of diagnostics and next tokens
+static auto test_positions() -> void
+{
+    using enum TestToken;
+
+    for (bool compile_dfa : { false, true }) {
+        Lexed malformed = lex("a = 12abc + 3;", compile_dfa);
+        EXPECT((malformed.types ==
+                std::vector{ IDENTIFIER, ASSIGN, ADD, INTEGER, SEPARATOR, EoF }));
+        EXPECT((malformed.columns == std::vector<size_t>{ 0, 2, 10, 12, 13, 14 }));
+        EXPECT((malformed.diagnostic_columns == std::vector<size_t>{ 4 }));
+
+        Lexed unknown = lex("x = 1 ? 2 + 3; ?? y", compile_dfa);
+        EXPECT((unknown.types ==
+                std::vector{ IDENTIFIER, ASSIGN, INTEGER, INTEGER, ADD, INTEGER,
+                             SEPARATOR, IDENTIFIER, EoF }));
+        EXPECT((unknown.columns ==
+                std::vector<size_t>{ 0, 2, 4, 8, 10, 12, 13, 18, 19 }));
+        EXPECT((unknown.diagnostic_columns == std::vector<size_t>{ 6, 15 }));
+    }
+
+    // lexer with tables isolates unknown tokens by the same terminals as items
+    TestLexer source{};
+    source.compile_dfa();
+
+    for (const char *input : { "x = 1a+=y; z @ q;", "12abc + 3", "a ?b;c" }) {
+        Lexed with_tables = lex<TableLexer>(input, false, source.get_dfa());
+        EXPECT(lex(input, false) == with_tables);
+    }
+
+    Lexed isolated = lex<TableLexer>("x = 1a+=y; z @ q;", false, source.get_dfa());
+    EXPECT((isolated.types ==
+            std::vector{ IDENTIFIER, ASSIGN, ADD_EQ, IDENTIFIER, SEPARATOR, IDENTIFIER,
+                         IDENTIFIER, SEPARATOR, EoF }));
+    EXPECT((isolated.diagnostic_lengths == std::vector<size_t>{ 2, 1 }));
+}
+
+// tokens, literals and comments may be longer than several chunks
+static auto test_stream() -> void
+{
+    using enum TestToken;
+
+    std::string identifier(100, 'a');
+    std::string literal = "\"" + std::string(70, ' ') + "\\\" " + std::string(70, 'b') + "\"";
+    std::string input   = "x = " + literal + "; /* " + std::string(90, '*') + " */ " +
+                        identifier + " + 12;";
+
+    std::stringstream stream(input);
+    TestLexer lexer{};
+    cerb::lex::StreamLexer<TestLexer, cerb::lex::StreamReader<char>> stream_lexer(
+        lexer, { stream }, "test", 16, 4);
+
+    Lexed streamed{};
+
+    for (const auto *token = stream_lexer.next_token(); token != nullptr;
+         token             = stream_lexer.next_token()) {
+        streamed.types.push_back(token->type);
+        streamed.reprs.emplace_back(token->repr.to_string());
+        streamed.columns.push_back(token->pos.char_number);
+    }
+
+    EXPECT(streamed == lex(input.c_str(), false));
+    EXPECT((streamed.types ==
+            std::vector{ IDENTIFIER, ASSIGN, STRING, SEPARATOR, IDENTIFIER, ADD,
+                         INTEGER, SEPARATOR, EoF }));
+    EXPECT(streamed.reprs[4] == identifier);
+
+    std::stringstream broken("x = \"" + std::string(100, 'c'));
+    TestLexer broken_lexer{};
+    cerb::lex::StreamLexer<TestLexer, cerb::lex::StreamReader<char>> broken_stream(
+        broken_lexer, { broken }, "test", 16, 4);
+    bool thrown = false;
+
+    try {
+        while (broken_stream.next_token() != nullptr) {}
+    } catch (const std::runtime_error & /*error*/) {
+        thrown = true;
+    }
+
+    EXPECT(thrown);
+}
+
+// bytes after ASCII are characters, unless UTF-8 is asked for
+static auto test_encoding() -> void
+{
+    using enum TestToken;
+    using cerb::lex::Encoding;
+
+    std::string cyrillic{};
+    std::string rule = "[";
+
+    // every other letter of Cyrillic and Greek alphabets: 29 intervals
+    for (u32 letter = 0x430; letter <= 0x44F; letter += 2) {
+        auto bytes = cerb::lex::utf8::encode(letter);
+        rule.append(bytes.begin(), bytes.begin() + cerb::lex::utf8::length(letter));
+    }
+
+    for (u32 letter = 0x3B1; letter <= 0x3C9; letter += 2) {
+        auto bytes = cerb::lex::utf8::encode(letter);
+        rule.append(bytes.begin(), bytes.begin() + cerb::lex::utf8::length(letter));
+    }
+
+    rule += "]+";
+
+    for (bool compile_dfa : { false, true }) {
+        Lexed latin1 = lex<ClassLexer>(
+            "caf\xE9 = na\xEFve;", compile_dfa, "[a-z\xC0-\xFF]+", Encoding::BYTES);
+        EXPECT((latin1.types ==
+                std::vector{ IDENTIFIER, ASSIGN, IDENTIFIER, SEPARATOR, EoF }));
+        EXPECT(latin1.reprs[0] == "caf\xE9");
+        EXPECT(latin1.diagnostics.empty());
+
+        // а, в and α, γ are in the class, б is not
+        Lexed unicode = lex<ClassLexer>(
+            "\u0430\u0432 = \u03B1\u03B3;\u0430 \u0431;", compile_dfa, rule.c_str(),
+            Encoding::UTF8);
+        EXPECT((unicode.types ==
+                std::vector{ IDENTIFIER, ASSIGN, IDENTIFIER, SEPARATOR, IDENTIFIER,
+                             SEPARATOR, EoF }));
+        EXPECT(unicode.reprs[0] == "\u0430\u0432");
+        EXPECT(unicode.reprs[4] == "\u0430");
+        EXPECT((unicode.diagnostics == std::vector<size_t>{ 15 }));
+    }
+}
+
+// values of numeric tokens are stored apart and found by copies of tokens
+static auto test_numbers() -> void
+{
+    using enum TestToken;
+    using token_t = TestLexer::token_t;
+
+    TestLexer lexer{};
+    cerb::lex::NumberIndex<char, TestToken> numbers{};
+    std::vector<token_t> tokens{};
+
+    numbers.decode_numbers(INTEGER, cerb::lex::INTEGER_NUMBER);
+
+    const char *input = "x = 255 + 18446744073709551616;";
+
+    for (const auto &token : lexer.tokens(input, "test")) {
+        numbers.add(token);
+        tokens.push_back(token);
+    }
+
+    EXPECT(numbers.size() == 2);
+    EXPECT(numbers.find(tokens[2]).as_integer() == 255);
+    EXPECT(!numbers.find(tokens[4]).is_integer());
+    EXPECT(numbers.find(tokens[4]).kind == cerb::lex::MALFORMED_NUMBER);
+    EXPECT(numbers.find(tokens[0]).kind == cerb::lex::NOT_NUMBER);
+
+    ClassLexer floating_lexer{ "[0-9]+[.]?[0-9]*", cerb::lex::Encoding::BYTES };
+    cerb::lex::NumberIndex<char, TestToken> floating{};
+    std::vector<token_t> floating_tokens{};
+
+    floating.decode_numbers(IDENTIFIER, cerb::lex::FLOATING_NUMBER);
+
+    for (const auto &token : floating_lexer.tokens("12.5;0.1;", "test")) {
+        floating.add(token);
+        floating_tokens.push_back(token);
+    }
+
+    EXPECT(floating.find(floating_tokens[0]).as_double() == 12.5);
+    EXPECT(floating.find(floating_tokens[2]).as_double() == 0.1);
+}
+
+// layout and closed comments are dropped from the buffer, when they are skipped
+static auto test_stream_layout() -> void
+{
+    using enum TestToken;
+
+    std::string input = "x =" + std::string(4000, ' ') + "1;";
+
+    for (size_t i = 0; i != 300; ++i) {
+        input += " /* c */ // d\n";
+    }
+
+    input += "y /* unfinished " + std::string(40, 'e') + " */ ;";
+
+    std::stringstream stream(input);
+    TestLexer lexer{};
+    cerb::lex::StreamLexer<TestLexer, cerb::lex::StreamReader<char>> stream_lexer(
+        lexer, { stream }, "test", 16, 4);
+
+    Lexed streamed{};
+    size_t buffer_size = 0;
+
+    for (const auto *token = stream_lexer.next_token(); token != nullptr;
+         token             = stream_lexer.next_token()) {
+        streamed.types.push_back(token->type);
+        streamed.reprs.emplace_back(token->repr.to_string());
+        streamed.columns.push_back(token->pos.char_number);
+        buffer_size = cerb::max(buffer_size, stream_lexer.buffer_size());
+    }
+
+    EXPECT(streamed == lex(input.c_str(), false));
+    EXPECT((streamed.types ==
+            std::vector{ IDENTIFIER, ASSIGN, INTEGER, SEPARATOR, IDENTIFIER,
+                         SEPARATOR, EoF }));
+    EXPECT(buffer_size < 128);
+}
+
+// keywords are found in spans of identifiers, unless identifiers go first
+static auto test_keywords() -> void
+{
+    using enum TestToken;
+
+    for (bool compile_dfa : { false, true }) {
+        Lexed dotted = lex<WordLexer>("for.each = for;", compile_dfa, 13U);
+        EXPECT((dotted.types == std::vector{ IDENTIFIER, ASSIGN, FOR, SEPARATOR, EoF }));
+        EXPECT(dotted.reprs[0] == "for.each");
+        EXPECT(dotted.diagnostics.empty());
+
+        Lexed identifiers = lex<WordLexer>("for = format;", compile_dfa, 1U);
+        EXPECT((identifiers.types ==
+                std::vector{ IDENTIFIER, ASSIGN, IDENTIFIER, SEPARATOR, EoF }));
+
+        for (const char *input : { "for12 = forx + for;", "for+=format;for" }) {
+            EXPECT(lex<HashedLexer>(input, compile_dfa) == lex(input, compile_dfa));
+        }
+    }
+}
+
+// files lexed by the pool are the same, as they are lexed one by one
+static auto test_driver() -> void
+{
+    using buffer_t = std::pair<std::string, std::string>;
+
+    std::vector<buffer_t> buffers{ { "a", "x = 1 + 2;" },
+                                   { "b", "z ? 1;" },
+                                   { "c", "for12 = forx + for; // c" },
+                                   { "d", "" } };
+
+    for (size_t workers : { 1UL, 4UL }) {
+        cerb::lex::ParallelLexer<TestLexer> pool{ workers };
+        auto result = pool.lex_buffers(buffers);
+
+        EXPECT(result.files.size() == buffers.size());
+        EXPECT(!result.files[1].succeeded());
+
+        // error of one file is kept in its result, other files are lexed
+        bool thrown = false;
+
+        try {
+            std::rethrow_exception(result.files[1].exception);
+        } catch (const cerb::analysis::lexical_analysis_error & /*error*/) {
+            thrown = true;
+        }
+
+        EXPECT(thrown);
+        EXPECT(result.total.tokens == 7 + 7 + 1);// x = 1 + 2 ; EoF
+
+        for (size_t i = 0; i != buffers.size(); ++i) {
+            if (i == 1) {
+                continue;
+            }
+
+            Lexed pooled{};
+            const auto &file = result.files[i];
+
+            EXPECT(file.succeeded());
+            EXPECT(file.lexer->filename() == buffers[i].first);
+
+            for (const auto &token : file.lexer->tokens()) {
+                pooled.types.push_back(token.type);
+                pooled.reprs.emplace_back(token.repr.to_string());
+                pooled.columns.push_back(token.pos.char_number);
+            }
+
+            EXPECT(pooled == lex(buffers[i].second.c_str(), false));
+        }
+    }
+}
+
+// views of tokens find their positions, fields, which don't fit, are rejected
+static auto test_token_buffer() -> void
+{
+    using buffer_t = cerb::lex::TokenBuffer<char, size_t>;
+
+    auto throws = [](auto &&function) {
+        try {
+            function();
+        } catch (const std::out_of_range & /*error*/) {
+            return true;
+        }
+        return false;
+    };
+
+    buffer_t buffer{};
+    cerb::string_view input = "a =\r\n  bc;";
+    u16 file                = buffer.add_file("test", input);
+
+    buffer.push_back(file, 0, 1, 7);
+    buffer.push_back(file, 7, 2, 7);
+    buffer.push_back(file, 9, 1, 3);
+
+    EXPECT(buffer[1].repr == "bc");
+    EXPECT(buffer[1].pos().line_number == 1);
+    EXPECT(buffer[1].pos().char_number == 2);
+    EXPECT(buffer[2].pos().char_number == 4);
+    EXPECT(buffer[0].pos().char_number == buffer.position(0).char_number);
+    EXPECT(buffer[1].pos().filename == "test");
+
+    EXPECT(throws([&buffer, file]() { buffer.push_back(file, 0, 1, 0x1'0000); }));
+    EXPECT(!throws([&buffer, file]() { buffer.push_back(file, 0, 1, 0xFFFF); }));
+
+    // size of file is only checked, so the view is never read
+    cerb::string_view huge{ input.begin(), size_t{ 1 } << 32U };
+    EXPECT(throws([&buffer, huge]() { buffer.add_file("huge", huge); }));
+
+    buffer_t files{};
+
+    for (size_t i = 0; i != 0x1'0000; ++i) {
+        files.add_file("file", input);
+    }
+
+    EXPECT(throws([&files, input]() { files.add_file("file", input); }));
+}
+
+// edits are scanned around themselves, tokens are the same as after a full scan
+static auto test_incremental() -> void
+{
+    using incremental_t = cerb::lex::IncrementalLexer<TestLexer>;
+
+    auto full_scan = [](const std::string &text) {
+        Lexed result{};
+        std::vector<size_t> lines{};
+        TestLexer lexer{};
+
+        for (const auto &token : lexer.tokens(text.c_str(), "test")) {
+            // incremental lexer keeps the end of input as an empty token
+            bool eof = token.type == TestToken::EoF;
+            result.types.push_back(token.type);
+            result.reprs.emplace_back(eof ? "" : token.repr.to_string());
+            result.columns.push_back(token.pos.char_number);
+            lines.push_back(token.pos.line_number);
+        }
+
+        return std::pair{ result, lines };
+    };
+
+    auto scanned = [](const incremental_t &incremental) {
+        Lexed result{};
+        std::vector<size_t> lines{};
+
+        for (const auto &token : incremental.tokens()) {
+            result.types.push_back(token.type);
+            result.reprs.emplace_back(incremental.repr(token).to_string());
+            result.columns.push_back(token.pos.char_number);
+            lines.push_back(token.pos.line_number);
+        }
+
+        return std::pair{ result, lines };
+    };
+
+    struct Edit
+    {
+        size_t offset;
+        size_t removed;
+        const char *inserted;
+    };
+
+    TestLexer lexer{};
+    incremental_t incremental{ lexer, "test" };
+    std::string text = "x = 1; /* a */ for12 += y;\nz = 2 + for; // c\nw;";
+
+    incremental.set_text(text);
+    EXPECT(scanned(incremental) == full_scan(text));
+
+    for (Edit edit : {
+             Edit{ 18, 0, "ab" },        // inside identifier: forab12
+             Edit{ 24, 0, " " },         // splits terminal: + =
+             Edit{ 24, 1, "" },          // joins it back: +=
+             Edit{ 0, 0, "q\n" },        // new line moves every token
+             Edit{ 12, 7, "b */ do" },   // from the comment into identifier
+             Edit{ 8, 0, " /* y =" },    // comment begins before the old one
+             Edit{ 8, 7, "" },           // and is removed
+             Edit{ 31, 0, "// " },       // line comment hides the whole line
+             Edit{ 31, 3, "" },          // and is removed
+             Edit{ 37, 5, "\n// " },     // line comment crosses two tokens
+             Edit{ 0, 2, "" },           // first line is removed
+         }) {
+        text.replace(edit.offset, edit.removed, edit.inserted);
+        incremental.update(
+            edit.offset, edit.removed, { edit.inserted, std::strlen(edit.inserted) });
+
+        EXPECT(incremental.text() == text);
+        EXPECT(scanned(incremental) == full_scan(text));
+    }
+
+    // edit at the end of long text scans only a few tokens again
+    text = "";
+
+    for (size_t i = 0; i != 100; ++i) {
+        text += "a" + std::to_string(i) + " = " + std::to_string(i) + ";\n";
+    }
+
+    incremental.set_text(text);
+    incremental.update(text.size() - 3, 0, "+1");
+    text.insert(text.size() - 3, "+1");
+
+    EXPECT(scanned(incremental) == full_scan(text));
+    EXPECT(incremental.rescanned() < 8);
+}
+
+// plain literals are views of input, escaped ones are unescaped into the arena
+static auto test_literals() -> void
+{
+    using enum TestToken;
+    using token_t = TestLexer::token_t;
+
+    std::string long_plain(40, 'p');
+    std::string long_escaped = std::string(3000, 'e') + "\\\"" + long_plain;
+    std::string input = "x = \"plain\" + \"es\\tc\" + 'a' + '\\n' + \"\" + \"" +
+                        long_plain + "\" + \"" + long_escaped + "\"";
+
+    // escaped literals fill more than one block of the arena, early ones stay
+    for (size_t i = 0; i != 200; ++i) {
+        input += " + \"abcdefghijklmnopqrst\\tq\"";
+    }
+
+    input += ";";
+
+    auto in_input = [&input](const token_t &token) {
+        return token.repr.begin() >= input.data() &&
+               token.repr.end() <= input.data() + input.size();
+    };
+
+    for (bool compile_dfa : { false, true }) {
+        TestLexer lexer{};
+        std::vector<token_t> literals{};
+
+        if (compile_dfa) {
+            lexer.compile_dfa();
+        }
+
+        for (const auto &token : lexer.tokens(input.c_str(), "test")) {
+            if (token.type == STRING || token.type == CHAR) {
+                literals.push_back(token);
+            }
+        }
+
+        EXPECT(literals.size() == 207);
+        EXPECT(literals[0].repr == "plain" && in_input(literals[0]));
+        EXPECT(literals[1].repr == "es\tc" && !in_input(literals[1]));
+        EXPECT(literals[2].repr == "a" && in_input(literals[2]));
+        EXPECT(literals[3].repr == "\n" && !in_input(literals[3]));
+        EXPECT(literals[4].repr.empty());
+        EXPECT(literals[5].repr == long_plain.c_str() && in_input(literals[5]));
+        EXPECT(literals[5].repr.begin() == input.data() + input.find(long_plain));
+        EXPECT(literals[6].repr.size() == 3041 && literals[6].repr[3000] == '"');
+        EXPECT(!in_input(literals[6]));
+        EXPECT(literals[206].repr == "abcdefghijklmnopqrst\tq");
+    }
+}
+
+// lexers of the same type keep their scan state apart and may run together
+static auto test_contexts() -> void
+{
+    auto pull = [](auto &lexer, Lexed &lexed) {
+        const auto *token = lexer.next_token();
+
+        if (token != nullptr) {
+            lexed.types.push_back(token->type);
+            lexed.reprs.emplace_back(token->repr.to_string());
+            lexed.columns.push_back(token->pos.char_number);
+        }
+
+        return token != nullptr;
+    };
+
+    const char *first  = "x = 1 + 22; // one\n  for12 += y;";
+    const char *second = "/* two\n */ abc = \"s\\t\" + 'c';\n\tfor + 3;";
+    const char *third  = "for.each = a.b; // three";
+
+    TestLexer first_lexer{};
+    TestLexer second_lexer{};
+    WordLexer third_lexer{ 13 };
+
+    first_lexer.set_input(first, "first");
+    second_lexer.set_input(second, "second");
+    third_lexer.set_input(third, "third");
+
+    Lexed first_lexed{};
+    Lexed second_lexed{};
+    Lexed third_lexed{};
+
+    // tokens are taken one by one from each lexer in turn
+    for (bool running = true; running;) {
+        running = pull(first_lexer, first_lexed);
+        running = pull(second_lexer, second_lexed) || running;
+        running = pull(third_lexer, third_lexed) || running;
+    }
+
+    EXPECT(first_lexed == lex(first, false));
+    EXPECT(second_lexed == lex(second, false));
+    EXPECT(third_lexed == lex<WordLexer>(third, false, 13U));
+
+    std::vector<std::thread> threads{};
+    std::array<bool, 4> same{};
+
+    for (size_t i = 0; i != same.size(); ++i) {
+        threads.emplace_back([i, &same, first, second]() {
+            std::string input = i % 2 == 0 ? first : second;
+            input += std::string(i, ' ') + " z" + std::to_string(i) + ";";
+
+            Lexed expected = lex(input.c_str(), false);
+            bool result    = true;
+
+            for (size_t times = 0; times != 100; ++times) {
+                result = lex(input.c_str(), times % 2 == 0) == expected && result;
+            }
+
+            same[i] = result;
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT((same == std::array{ true, true, true, true }));
+}
+
+// mapped files end with '\0', even when they end on the boundary of page
+static auto test_mapped_source() -> void
+{
+    using source_t = cerb::lex::MappedSource<char>;
+
+#ifdef CERBERUS_HAS_MMAP
+    auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#else
+    size_t page = 4096;
+#endif
+
+    auto path = std::filesystem::temp_directory_path() / "cerberus_mapped_source";
+
+    for (size_t size : { page, 2 * page, page - 1, size_t{ 0 } }) {
+        std::string content{};
+
+        while (content.size() < size) {
+            content += "x1 = 23;\n";
+        }
+
+        // the last token touches the end of file
+        content.resize(size);
+
+        if (size >= 2) {
+            content.replace(size - 2, 2, " z");
+        }
+
+        std::ofstream(path, std::ios::binary) << content;
+
+        source_t source{ path.string() };
+        const char *data = source.data();
+
+        EXPECT(source.view() == content.c_str());
+        EXPECT(data != nullptr && data[size] == '\0');
+        EXPECT(lex(data, false) == lex(content.c_str(), false));
+
+        source_t moved{ std::move(source) };
+        EXPECT(moved.data() == data && moved.size() == size);
+
+        source_t unpadded{ path.string(), false };
+        EXPECT(unpadded.view() == content.c_str());
+    }
+
+    std::filesystem::remove(path);
+}
+
+// the longest terminal is found among terminals with common prefixes
+static auto test_terminals() -> void
+{
+    using container_t = cerb::lex::TerminalContainer<char, size_t, 16, 4>;
+
+    // '<<' is not a terminal, '->' is declared twice: the first one wins
+    static constexpr container_t terminals{
+        { { 1, '-' }, { 2, '>' }, { 3, '<' }, { 4, '\xC2' } },
+        { { 5, "->"_sv },
+          { 6, "->*"_sv },
+          { 7, ">>"_sv },
+          { 8, ">>="_sv },
+          { 9, "<<="_sv },
+          { 10, "<="_sv },
+          { 11, "->"_sv } }
+    };
+
+    static_assert(terminals.check(0, "->*"_sv).second == 6);
+    static_assert(terminals.check('-').first && !terminals.check('*').first);
+
+    auto longest = [](const char *input, size_t offset = 0) {
+        auto [repr, type] = terminals.check(offset, input);
+        return std::pair{ std::string(repr.to_string()), type };
+    };
+
+    EXPECT((longest("->*x") == std::pair{ "->*"s, size_t{ 6 } }));
+    EXPECT((longest("->x") == std::pair{ "->"s, size_t{ 5 } }));
+    EXPECT((longest("-x") == std::pair{ "-"s, size_t{ 1 } }));
+    EXPECT((longest("-") == std::pair{ "-"s, size_t{ 1 } }));
+    EXPECT((longest("<<x") == std::pair{ "<"s, size_t{ 3 } }));
+    EXPECT((longest("<<=") == std::pair{ "<<="s, size_t{ 9 } }));
+    EXPECT((longest("<=<") == std::pair{ "<="s, size_t{ 10 } }));
+    EXPECT((longest(">>>=", 1) == std::pair{ ">>="s, size_t{ 8 } }));
+    EXPECT((longest(">>") == std::pair{ ">>"s, size_t{ 7 } }));
+    EXPECT((longest("\xC2\xA0") == std::pair{ "\xC2"s, size_t{ 4 } }));
+    EXPECT((longest("x->") == std::pair{ ""s, size_t{ 0 } }));
+    EXPECT(terminals.check('\xC2').second == 4);
+    EXPECT(terminals.check('*').second == 0);
+}
+
+// batches give the same tokens as scan, yield stops them in the middle
+static auto test_batches() -> void
+{
+    using token_t = TestLexer::token_t;
+
+    const char *input = "x = \"a\\tb\" + 1;\n for12 += 'c'; /* c */ y = for;";
+
+    RecordingLexer scanned{};
+    scanned.scan(input, "test");
+
+    EXPECT(scanned.finished);
+    EXPECT(scanned.lexed == lex(input, false));
+
+    size_t tokens = scanned.lexed.types.size();
+
+    for (size_t size : { 1UL, 3UL, 64UL }) {
+        std::vector<token_t> buffer(size);
+        RecordingLexer batched{};
+        batched.scan_batched(input, "test", buffer);
+
+        EXPECT(batched.finished);
+        EXPECT(batched.lexed == scanned.lexed);
+        EXPECT(batched.batches.size() == (tokens + size - 1) / size);
+        EXPECT(batched.batches.front() == cerb::min(size, tokens));
+
+        RecordingLexer stopped{};
+        stopped.limit = 5;
+        stopped.scan_batched(input, "test", buffer);
+
+        EXPECT(stopped.finished);
+        EXPECT(stopped.lexed.types.size() == 5);
+        EXPECT(stopped.batches.size() == (5 + size - 1) / size);
+    }
+}
+
+// only items, which may begin with the first char, are tried, as DFA tries all
+static auto test_dispatch() -> void
+{
+    using enum TestToken;
+
+    for (const char *input :
+         { "x = ~12 + ~3 +4;", "__ab = .5 + 1.25;", "for_x = _for;", "a~1;b+=~2",
+           "+~3;", "x=9.;", "_=+", "for9 = ;" }) {
+        EXPECT(lex<DispatchLexer>(input, false) == lex<DispatchLexer>(input, true));
+    }
+
+    Lexed signs = lex<DispatchLexer>("x = ~12 + ~3 +4;", false);
+    EXPECT((signs.types == std::vector{ IDENTIFIER, ASSIGN, INTEGER, ADD, INTEGER,
+                                        ADD, INTEGER, SEPARATOR, EoF }));
+    EXPECT((signs.reprs[2] == "~12" && signs.reprs[4] == "~3"));
+
+    Lexed underscores = lex<DispatchLexer>("__ab = .5 + 1.25;", false);
+    EXPECT((underscores.types ==
+            std::vector{ IDENTIFIER, ASSIGN, FLOAT, ADD, FLOAT, SEPARATOR, EoF }));
+    EXPECT(underscores.diagnostics.empty());
+}
+
+// items are kept in one array in priority order, the first of equal ones wins
+static auto test_priorities() -> void
+{
+    using enum TestToken;
+
+    PriorityLexer<false> ordered{};
+    PriorityLexer<true> shuffled{};
+
+    auto order = ordered.item_order();
+
+    EXPECT(order == shuffled.item_order());
+    EXPECT(std::is_sorted(order.begin(), order.end()));
+    EXPECT(std::adjacent_find(order.begin(), order.end()) == order.end());
+
+    for (const char *input : { "ab12 = 3;", "x = for + 1.5;", "forab = 12.;" }) {
+        for (bool compile_dfa : { false, true }) {
+            Lexed expected = lex<PriorityLexer<false>>(input, compile_dfa);
+            EXPECT(lex<PriorityLexer<true>>(input, compile_dfa) == expected);
+            EXPECT(lex<PriorityLexer<false>>(input, !compile_dfa) == expected);
+        }
+    }
+
+    // identifier with digits would take the whole word
+    Lexed digits = lex<PriorityLexer<true>>("ab12 = 3;", false);
+    EXPECT((digits.types == std::vector{ ASSIGN, INTEGER, SEPARATOR, EoF }));
+    EXPECT((digits.diagnostics == std::vector<size_t>{ 0 }));
+}
+
+// lexer without positions finds the same tokens, positions are found by offsets
+static auto test_untracked() -> void
+{
+    using untracked_t = GeneratedLexer<
+        char, TestToken, true, 0, true, true, 128, 4, false>;
+    using collector_t = cerb::lex::OffsetTokenCollector<GeneratedLexer<>>;
+
+    static_assert(std::is_same_v<collector_t::lexer_t, untracked_t>);
+
+    const char *input = "x = 1;\r\n  /* a\nb */ for12 += y // c\n\n\tz = 2 + for;";
+
+    for (bool compile_dfa : { false, true }) {
+        Lexed tracked   = lex<GeneratedLexer<>>(input, compile_dfa);
+        Lexed untracked = lex<untracked_t>(input, compile_dfa);
+
+        EXPECT(tracked.types == untracked.types);
+        EXPECT(tracked.reprs == untracked.reprs);
+    }
+
+    std::vector<std::pair<std::string, std::string>> buffers{ { "a", input },
+                                                              { "b", "x =\n  ?;" } };
+    cerb::lex::ParallelLexer<GeneratedLexer<>, cerb::lex::OffsetTokenCollector> pool{
+        1
+    };
+    auto result = pool.lex_buffers(buffers);
+    auto &file  = *result.files[0].lexer;
+
+    std::vector<size_t> columns{};
+    std::vector<size_t> lines{};
+
+    for (size_t i = 0; i != file.tokens().size(); ++i) {
+        columns.push_back(file.position(i).char_number);
+        lines.push_back(file.position(i).line_number);
+    }
+
+    TestLexer lexer{};
+    std::vector<size_t> expected_lines{};
+
+    for (const auto &token : lexer.tokens(input, "test")) {
+        expected_lines.push_back(token.pos.line_number);
+    }
+
+    EXPECT(columns == lex(input, false).columns);
+    EXPECT(lines == expected_lines);
+
+    try {
+        std::rethrow_exception(result.files[1].exception);
+    } catch (const cerb::analysis::lexical_analysis_error &error) {
+        EXPECT(std::string(error.what()).ends_with("line: 2, column: 3)"));
+    }
+}
+
+// inputs for simd: a little shorter, as long as and a little longer than block
+static auto simd_lengths() -> std::vector<size_t>
+{
+    size_t width = cerb::lex::simd::width == 0 ? 16 : cerb::lex::simd::width;
+    return { width - 1, width, width + 1, 2 * width + 1 };
+}
+
+// fills input with @p filler from @p phase and puts @p stop at @p index
+static auto simd_input(
+    size_t length, const std::string &filler, size_t phase, size_t index, char stop)
+    -> std::string
+{
+    std::string input(length, ' ');
+
+    for (size_t i = 0; i != length; ++i) {
+        input[i] = filler[(i + phase) % filler.size()];
+    }
+
+    if (index < length) {
+        input[index] = stop;
+    }
+
+    return input;
+}
+
+// span, which is found char by char
+template<typename Stop>
+static auto scalar_span(const std::string &input, Stop &&stop)
+    -> cerb::lex::simd::Span
+{
+    cerb::lex::simd::Span span{};
+    size_t carriage = 0;
+    size_t index    = 0;
+
+    for (; index != input.size() && !stop(input[index]); ++index) {
+        if (input[index] == '\n') {
+            ++span.newlines;
+            span.line_begin = index + 1;
+            carriage        = 0;
+        } else if (input[index] == '\r') {
+            ++carriage;
+        }
+    }
+
+    span.length  = index;
+    span.columns = index - span.line_begin - carriage;
+    return span;
+}
+
+static auto same_span(
+    const cerb::lex::simd::Span &lhs, const cerb::lex::simd::Span &rhs) -> bool
+{
+    return lhs.length == rhs.length && lhs.newlines == rhs.newlines &&
+           lhs.line_begin == rhs.line_begin && lhs.columns == rhs.columns;
+}
+
+// blocks of layout count lines and columns as characters do
+static auto test_simd_layout() -> void
+{
+    using namespace cerb::lex;
+
+    for (size_t length : simd_lengths()) {
+        for (char stop : { 'a', '\0', '\x80', '\xFF' }) {
+            for (size_t index = 0; index <= length; ++index) {
+                for (size_t phase = 0; phase != 4; ++phase) {
+                    auto input = simd_input(length, " \t\r\n", phase, index, stop);
+                    const char *first = input.data();
+                    const char *last  = first + input.size();
+                    auto expected     = scalar_span(
+                        input, [](char chr) { return !is_layout(chr); });
+
+                    EXPECT(same_span(simd::skip_layout(first, last), expected));
+                    EXPECT(simd::skip_layout<false>(first, last).length ==
+                           expected.length);
+                }
+            }
+        }
+    }
+}
+
+// bodies of comments are skipped until their end, lines are counted on the way
+static auto test_simd_comments() -> void
+{
+    using namespace cerb::lex;
+
+    for (size_t length : simd_lengths()) {
+        for (char value : { '*', '\n' }) {
+            // body of line comment has no new lines
+            auto filler = value == '\n' ? "a\r\0\x80 "s : "a\n\r\0\xFF"s;
+
+            for (size_t index = 0; index <= length; ++index) {
+                for (size_t phase = 0; phase != 5; ++phase) {
+                    auto input = simd_input(length, filler, phase, index, value);
+                    const char *first = input.data();
+                    const char *last  = first + input.size();
+                    auto span         = simd::skip_until(first, last, value);
+                    auto expected     = scalar_span(
+                        input, [value](char chr) { return chr == value; });
+
+                    EXPECT(same_span(span, expected));
+                    EXPECT(simd::skip_until<false>(first, last, value).length ==
+                           expected.length);
+                }
+            }
+        }
+
+        // span may stop at any of several characters
+        for (size_t index = 0; index <= length; ++index) {
+            auto input = simd_input(length, "\n\r\x80 z\n"s, index, index, '\0');
+            auto stop  = [](char chr) { return chr == '\0' || chr == 'z'; };
+            auto span  = simd::skip_span(
+                input.data(), input.data() + input.size(),
+                [](const auto &block) { return block.equal(0) | block.equal('z'); },
+                stop);
+
+            EXPECT(same_span(span, scalar_span(input, stop)));
+        }
+    }
+}
+
+// characters before @p index, which are in whole blocks, when simd is @p enabled
+static auto simd_counted(size_t length, size_t index, bool enabled) -> size_t
+{
+    if (!enabled) {
+        return 0;
+    }
+
+    return cerb::min(index, length - length % cerb::lex::simd::width);
+}
+
+// runs of characters from set are counted by whole blocks only
+static auto test_simd_lookup() -> void
+{
+    using namespace cerb::lex;
+
+    auto set = simd::make_lookup([](size_t chr) {
+        return is_letter_or_digit(static_cast<char>(chr)) || chr == '_';
+    });
+
+    // 0xE1 has the low nibble of 'a', 0x80 the low nibble of '0'
+    std::string stops  = " \0\n\r`@\x80\xE1\xFF"s;
+    std::string filler = "abz09AZ_";
+    bool enabled       = simd::lookup_enabled<char>;
+
+    for (size_t length : simd_lengths()) {
+        for (char stop : stops) {
+            for (size_t index = 0; index <= length; ++index) {
+                auto input        = simd_input(length, filler, index, index, stop);
+                const char *first = input.data();
+                size_t count      = simd::count_in(set, first, first + length);
+
+                EXPECT(count == simd_counted(length, index, enabled));
+            }
+        }
+    }
+}
+
+// bodies of literals are searched for their stops by whole blocks only
+static auto test_simd_literals() -> void
+{
+    using namespace cerb::lex;
+
+    std::string filler = "a \r\n\x80\xFF'";
+    bool enabled       = simd::enabled<char>;
+
+    for (size_t length : simd_lengths()) {
+        for (char stop : { '\"', '\\', '\0' }) {
+            for (size_t index = 0; index <= length; ++index) {
+                auto input        = simd_input(length, filler, index, index, stop);
+                const char *first = input.data();
+                size_t count =
+                    simd::count_until(first, first + length, '\"', '\\', '\0');
+
+                EXPECT(count == simd_counted(length, index, enabled));
+            }
+        }
+    }
+}
+
+auto main() -> int
+{
+    try {
+        test_token_end();
+        test_positions();
+        test_keywords();
+        test_encoding();
+        test_numbers();
+        test_stream();
+        test_stream_layout();
+        test_driver();
+        test_token_buffer();
+        test_literals();
+        test_contexts();
+        test_mapped_source();
+        test_terminals();
+        test_batches();
+        test_dispatch();
+        test_priorities();
+        test_untracked();
+        test_incremental();
+        test_simd_layout();
+        test_simd_comments();
+        test_simd_lookup();
+        test_simd_literals();
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
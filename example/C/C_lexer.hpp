@@ -354,7 +354,8 @@ namespace cerb {
         bool AllowStringLiterals = true,             \
         bool AllowComments = true,                   \
         size_t MaxTerminals = 128,                  \
-        size_t MaxSize4Terminals = 4>
+        size_t MaxSize4Terminals = 4,             \
+        bool TrackPositions = true>
 
 #define Lex4CDefinition(CLASS) CalculatorTemplate struct CLASS : public Lex4C<>
 
@@ -369,6 +370,7 @@ namespace cerb {
         using string_view_t    = typename parent::string_view_t;                    \
         using string_checker_t = typename parent::string_checker_t;                 \
         using item_initializer  = typename parent::item_initializer;                \
+        using keyword_set_t    = typename parent::keyword_set_t;                    \
         using enum Lex4CItem;
 
 Lex4CTemplate
@@ -377,31 +379,586 @@ struct Lex4C: public CERBERUS_LEX_PARENT_CLASS
     CERBERUS_LEX_PARENT_CLASS_ACCESS
     using enum Lex4CItem;
 
+    static constexpr size_t dfa_states = 108;
+    static constexpr size_t dfa_columns = 45;
+
+    static constexpr std::array<u8, 256> dfa_classes{
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 2, 0, 3, 4, 0, 5, 6, 7, 8, 9, 10, 11, 12,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 14, 15, 16, 17, 18,
+        0, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 19, 21, 0, 22, 23, 19,
+        0, 24, 25, 26, 27, 28, 29, 30, 31, 32, 19, 19, 33, 19, 34, 35,
+        19, 19, 36, 37, 38, 39, 19, 40, 19, 19, 19, 41, 42, 43, 44, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr std::array<u16, 4860> dfa_transitions{
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+        4, 5, 6, 7, 8, 9, 10, 11, 0, 12, 13, 14, 15, 16, 17, 18,
+        19, 0, 20, 21, 22, 19, 19, 23, 24, 19, 25, 19, 19, 26, 27, 19,
+        19, 28, 29, 19, 30, 31, 32, 33, 34, 35, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 44, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19,
+        0, 0, 0, 51, 19, 19, 19, 19, 19, 19, 52, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 53, 19, 19, 19, 19,
+        19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 54, 19, 55, 19, 19, 19, 19, 19, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+        0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 56, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+        0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 57, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19,
+        19, 0, 0, 0, 19, 19, 19, 19, 58, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0,
+        0, 19, 19, 19, 19, 19, 19, 19, 59, 60, 19, 19, 19, 19, 19, 19,
+        19, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 62, 19, 19, 19, 19, 19, 19, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19,
+        19, 19, 63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 69, 19, 19, 19,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 70, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0,
+        0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 71, 19, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+        0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 72, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19,
+        0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 73,
+        19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 74, 19,
+        19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 75, 19, 19, 19, 19, 19, 19, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+        0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 76, 19, 19, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+        0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 77, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19,
+        19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 78, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0,
+        0, 19, 19, 19, 19, 19, 19, 19, 19, 79, 19, 19, 19, 19, 19, 19,
+        19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 80, 19, 19, 19, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19,
+        19, 19, 19, 81, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0,
+        0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 82, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+        0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 83, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19,
+        0, 0, 0, 19, 84, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0,
+        85, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+        0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+        0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 86, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19,
+        19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 87, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0,
+        0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 88, 19, 19,
+        19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 89, 19, 19, 19, 19, 19, 19, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 90, 19, 19, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+        0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+        91, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+        19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 92, 19,
+        19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0,
+        0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 93, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0,
+        0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 94, 19, 19, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+        0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19,
+        0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 95,
+        19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 96, 19,
+        19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19,
+        19, 97, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+        0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 98, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+        0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 99, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19,
+        19, 0, 0, 0, 19, 19, 19, 19, 100, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0,
+        0, 19, 19, 19, 19, 101, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 102, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+        0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+        19, 19, 0, 0, 0, 19, 19, 19, 103, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0,
+        0, 0, 19, 19, 19, 19, 19, 19, 19, 104, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 105, 19, 19, 19, 19, 19, 19,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0,
+        0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+        0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19,
+        0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19,
+        19, 106, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+        0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 107, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+        0, 0, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+    };
+
+    static constexpr std::array<TokenType, 108> dfa_accept{
+        UNDEFINED,
+        UNDEFINED,
+        LOGICAL_NOT,
+        PREPROCESSOR,
+        MOD,
+        AND,
+        LEFT_PARENTHESIS,
+        RIGHT_PARENTHESIS,
+        MUL,
+        ADD,
+        COMMA,
+        SUB,
+        DIV,
+        INTEGER,
+        SEPARATOR,
+        LESS,
+        ASSIGN,
+        GREATER,
+        QUESTION_MARK,
+        IDENTIFIER,
+        ANGLE_OPENING,
+        ANGLE_CLOSING,
+        XOR,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        CURLY_OPENING,
+        OR,
+        CURLY_CLOSING,
+        NOT,
+        LOGICAL_NOT_EQUAL,
+        MOD_EQ,
+        LOGICAL_AND,
+        AND_EQ,
+        MUL_EQ,
+        ADD_EQ,
+        SUB_EQ,
+        DIV_EQ,
+        DOUBLE,
+        LEFT_SHIFT,
+        LESS_EQ,
+        LOGICAL_EQUAL,
+        GREATER_EQ,
+        RIGHT_SHIFT,
+        XOR_EQ,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        OR_EQ,
+        LOGICAL_OR,
+        FLOAT,
+        LEFT_SHIFT_EQ,
+        RIGHT_SHIFT_EQ,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        FOR,
+        INT,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        CASE,
+        CHAR_T,
+        IDENTIFIER,
+        IDENTIFIER,
+        LONG,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        FLOAT_T,
+        IDENTIFIER,
+        SHORT,
+        IDENTIFIER,
+        IDENTIFIER,
+        IDENTIFIER,
+        WHILE,
+        DOUBLE_T,
+        RETURN,
+        SIGNED,
+        SWITCH,
+        IDENTIFIER,
+        IDENTIFIER,
+        UNSIGNED,
+    };
+
+    static constexpr std::array<TokenType, 108> dfa_partial{
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        FLOAT,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+        UNDEFINED,
+    };
+
+    static constexpr std::array<u32, 108> dfa_priority{
+        4294967295, 4294967295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0,
+        0, 0, 0, 12, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0,
+        0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        0, 0, 12, 0, 0, 12, 12, 12, 12, 2, 2, 12, 12, 12, 12, 12,
+        12, 12, 2, 2, 12, 12, 2, 12, 12, 12, 12, 12, 12, 12, 2, 12,
+        2, 12, 12, 12, 2, 2, 2, 2, 2, 12, 12, 2,
+    };
+
+    static constexpr std::array<u8, 108> dfa_flags{
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+        1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 1, 1, 1,
+        1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        1, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    };
+
     constexpr Lex4C()
     : parent(
         '\"',
         '\'',
         STRING,
         CHAR,
-        {
-            { FOR, "for"_sv, true, 2 },
-            { WHILE, "while"_sv, true, 2 },
-            { RETURN, "return"_sv, true, 2 },
-            { CASE, "case"_sv, true, 2 },
-            { SWITCH, "switch"_sv, true, 2 },
-            { INT, "int"_sv, true, 2 },
-            { CHAR_T, "char"_sv, true, 2 },
-            { LONG, "long"_sv, true, 2 },
-            { SHORT, "short"_sv, true, 2 },
-            { FLOAT_T, "float"_sv, true, 2 },
-            { DOUBLE_T, "double"_sv, true, 2 },
-            { SIGNED, "signed"_sv, true, 2 },
-            { UNSIGNED, "unsigned"_sv, true, 2 },
-            { INTEGER, "[0-9]+"_sv, false, 12 },
-            { FLOAT, "[0-9]+[.][0-9]*[f]"_sv, false, 12 },
-            { DOUBLE, "[0-9]+[.][0-9]*"_sv, false, 12 },
-            { IDENTIFIER, "[a-zA_Z_]+[a-zA-Z0-9_]*"_sv, false, 12 }
-        },
+        { dfa_transitions.data(), dfa_classes.data(), dfa_columns,
+           dfa_accept.data(), dfa_partial.data(), dfa_priority.data(),
+           dfa_flags.data(), dfa_states },
         {
             { 
                 { ADD, '+' },
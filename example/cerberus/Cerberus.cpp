@@ -69,12 +69,11 @@
 /* First part of user prologue.  */
 #line 1 "Cerberus.yy"
 
-#include <fstream>
-#include <sstream>
 #include <iostream>
+#include <cerberus/analyzation/lex/mapped_source.hpp>
 #include "Cerberus_yacc_helper.hpp"
 
-#line 78 "Cerberus.cpp"
+#line 77 "Cerberus.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -2050,109 +2049,109 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* library: library function  */
-#line 85 "Cerberus.yy"
+#line 84 "Cerberus.yy"
                                         { yyval = CL::ParserNode::construct_root( CL::parser.global_view_node, {yyvsp[0]}); }
-#line 2056 "Cerberus.cpp"
+#line 2055 "Cerberus.cpp"
     break;
 
   case 3: /* library: %empty  */
-#line 86 "Cerberus.yy"
+#line 85 "Cerberus.yy"
                                         { yyval = CL::parser.global_view_node; }
-#line 2062 "Cerberus.cpp"
+#line 2061 "Cerberus.cpp"
     break;
 
   case 4: /* function: "func" IDENTIFIER "(" ")" "{" stmt "}"  */
-#line 89 "Cerberus.yy"
+#line 88 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-6], {yyvsp[-5], yyvsp[-1]}); }
-#line 2068 "Cerberus.cpp"
+#line 2067 "Cerberus.cpp"
     break;
 
   case 6: /* expr: INTEGER  */
-#line 93 "Cerberus.yy"
+#line 92 "Cerberus.yy"
                                                         { yyval = yyvsp[0]; }
-#line 2074 "Cerberus.cpp"
+#line 2073 "Cerberus.cpp"
     break;
 
   case 7: /* expr: FLOAT  */
-#line 94 "Cerberus.yy"
+#line 93 "Cerberus.yy"
                                                         { yyval = yyvsp[0]; }
-#line 2080 "Cerberus.cpp"
+#line 2079 "Cerberus.cpp"
     break;
 
   case 8: /* expr: DOUBLE  */
-#line 95 "Cerberus.yy"
+#line 94 "Cerberus.yy"
                                                         { yyval = yyvsp[0]; }
-#line 2086 "Cerberus.cpp"
+#line 2085 "Cerberus.cpp"
     break;
 
   case 9: /* expr: CHAR  */
-#line 96 "Cerberus.yy"
+#line 95 "Cerberus.yy"
                                                         { yyval = yyvsp[0]; }
-#line 2092 "Cerberus.cpp"
+#line 2091 "Cerberus.cpp"
     break;
 
   case 10: /* expr: STRING  */
-#line 97 "Cerberus.yy"
+#line 96 "Cerberus.yy"
                                                         { yyval = yyvsp[0]; }
-#line 2098 "Cerberus.cpp"
+#line 2097 "Cerberus.cpp"
     break;
 
   case 11: /* expr: IDENTIFIER  */
-#line 98 "Cerberus.yy"
+#line 97 "Cerberus.yy"
                                                         { yyval = yyvsp[0]; }
-#line 2104 "Cerberus.cpp"
+#line 2103 "Cerberus.cpp"
     break;
 
   case 12: /* expr: expr "+" expr  */
-#line 99 "Cerberus.yy"
+#line 98 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-1], {yyvsp[-2], yyvsp[0]}); }
-#line 2110 "Cerberus.cpp"
+#line 2109 "Cerberus.cpp"
     break;
 
   case 13: /* expr: expr "*" expr  */
-#line 100 "Cerberus.yy"
+#line 99 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-1], {yyvsp[-2], yyvsp[0]}); }
-#line 2116 "Cerberus.cpp"
+#line 2115 "Cerberus.cpp"
     break;
 
   case 14: /* expr: "(" expr ")"  */
-#line 101 "Cerberus.yy"
+#line 100 "Cerberus.yy"
                                                         { yyval = yyvsp[-1]; }
-#line 2122 "Cerberus.cpp"
+#line 2121 "Cerberus.cpp"
     break;
 
   case 15: /* stmt: stmt expr ";"  */
-#line 106 "Cerberus.yy"
+#line 105 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-2], {yyvsp[-1]});  }
-#line 2128 "Cerberus.cpp"
+#line 2127 "Cerberus.cpp"
     break;
 
   case 16: /* stmt: stmt "return" expr ";"  */
-#line 107 "Cerberus.yy"
+#line 106 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-3], {CL::ParserNode::construct_root(yyvsp[-2], {yyvsp[-1]})}); }
-#line 2134 "Cerberus.cpp"
+#line 2133 "Cerberus.cpp"
     break;
 
   case 17: /* stmt: stmt ";"  */
-#line 108 "Cerberus.yy"
+#line 107 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-1], {yyvsp[0]}); }
-#line 2140 "Cerberus.cpp"
+#line 2139 "Cerberus.cpp"
     break;
 
   case 18: /* stmt: stmt "{" stmt "}"  */
-#line 109 "Cerberus.yy"
+#line 108 "Cerberus.yy"
                                                         { yyval = CL::ParserNode::construct_root(yyvsp[-3], {yyvsp[-1]}); }
-#line 2146 "Cerberus.cpp"
+#line 2145 "Cerberus.cpp"
     break;
 
   case 19: /* stmt: %empty  */
-#line 110 "Cerberus.yy"
+#line 109 "Cerberus.yy"
                                                         { yyval = CL::Parser::new_statement(); }
-#line 2152 "Cerberus.cpp"
+#line 2151 "Cerberus.cpp"
     break;
 
 
-#line 2156 "Cerberus.cpp"
+#line 2155 "Cerberus.cpp"
 
       default: break;
     }
@@ -2345,7 +2344,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 112 "Cerberus.yy"
+#line 111 "Cerberus.yy"
 
 
 
@@ -2365,14 +2364,17 @@ int yylex(void) {
 }
 
 
-auto main() -> int {
-    std::ifstream t("/home/vaskozlov/projects/libcerberus/example/cerberus/example.lcerb");
-    std::stringstream buffer{};
-    buffer << t.rdbuf();
-    t.close();
-    std::string data = buffer.str();
+#ifndef CERBERUS_EXAMPLE_DIR
+#define CERBERUS_EXAMPLE_DIR "."
+#endif
+
+// example.lcerb from the directory of this example is parsed by default
+auto main(int argc, char *argv[]) -> int {
+    std::string filename = argc > 1 ? argv[1] : CERBERUS_EXAMPLE_DIR "/example.lcerb";
+    cerb::lex::MappedSource<char> source(filename);
 
-    CL::parser.cerberus_lexer.scan(data.c_str(), "example.lcerb");
+    CL::parser.cerberus_lexer.set_input(
+        source.view(), { filename.data(), filename.size() });
     yyparse();
     CL::parser.print();
 }
@@ -1,7 +1,6 @@
 %{
-#include <fstream>
-#include <sstream>
 #include <iostream>
+#include <cerberus/analyzation/lex/mapped_source.hpp>
 #include "Cerberus_yacc_helper.hpp"
 %}
 
@@ -128,14 +127,17 @@ int yylex(void) {
 }
 
 
-auto main() -> int {
-    std::ifstream t("/home/vaskozlov/projects/libcerberus/example/cerberus/example.lcerb");
-    std::stringstream buffer{};
-    buffer << t.rdbuf();
-    t.close();
-    std::string data = buffer.str();
+#ifndef CERBERUS_EXAMPLE_DIR
+#define CERBERUS_EXAMPLE_DIR "."
+#endif
 
-    CL::parser.cerberus_lexer.scan(data.c_str(), "example.lcerb");
+// example.lcerb from the directory of this example is parsed by default
+auto main(int argc, char *argv[]) -> int {
+    std::string filename = argc > 1 ? argv[1] : CERBERUS_EXAMPLE_DIR "/example.lcerb";
+    cerb::lex::MappedSource<char> source(filename);
+
+    CL::parser.cerberus_lexer.set_input(
+        source.view(), { filename.data(), filename.size() });
     yyparse();
     CL::parser.print();
 }
@@ -368,7 +368,8 @@ namespace cerb {
         bool AllowStringLiterals = true,             \
         bool AllowComments = true,                   \
         size_t MaxTerminals = 64,                  \
-        size_t MaxSize4Terminals = 4>
+        size_t MaxSize4Terminals = 4,             \
+        bool TrackPositions = true>
 
 #define CerberusLexerDefinition(CLASS) CalculatorTemplate struct CLASS : public CerberusLexer<>
 
@@ -383,6 +384,7 @@ namespace cerb {
         using string_view_t    = typename parent::string_view_t;                    \
         using string_checker_t = typename parent::string_checker_t;                 \
         using item_initializer  = typename parent::item_initializer;                \
+        using keyword_set_t    = typename parent::keyword_set_t;                    \
         using enum CerberusLexerItem;
 
 CerberusLexerTemplate
@@ -391,6 +393,23 @@ struct CerberusLexer: public CERBERUS_LEX_PARENT_CLASS
     CERBERUS_LEX_PARENT_CLASS_ACCESS
     using enum CerberusLexerItem;
 
+    static constexpr keyword_set_t keywords{
+        { "for"_sv, FOR, 2 },
+        { "while"_sv, WHILE, 2 },
+        { "return"_sv, RETURN, 2 },
+        { "case"_sv, CASE, 2 },
+        { "switch"_sv, SWITCH, 2 },
+        { "func"_sv, FUNC, 2 },
+        { "var"_sv, VAR, 2 },
+        { "____parser_statement"_sv, STMT, 2 },
+        { "____globalView"_sv, GLOBAL_VIEW, 2 },
+        { "int"_sv, INT_T, 2 },
+        { "char"_sv, CHAR_T, 2 },
+        { "float"_sv, FLOAT_T, 2 },
+        { "double"_sv, DOUBLE_T, 2 },
+        { "__builtin_auto"_sv, BUILTIN_AUTO_T, 2 },
+    };
+
     constexpr CerberusLexer()
     : parent(
         '\"',
@@ -398,26 +417,13 @@ struct CerberusLexer: public CERBERUS_LEX_PARENT_CLASS
         STRING,
         CHAR,
         {
-            { FOR, "for"_sv, true, 2 },
-            { WHILE, "while"_sv, true, 2 },
-            { RETURN, "return"_sv, true, 2 },
-            { CASE, "case"_sv, true, 2 },
-            { SWITCH, "switch"_sv, true, 2 },
-            { FUNC, "func"_sv, true, 2 },
-            { VAR, "var"_sv, true, 2 },
-            { STMT, "____parser_statement"_sv, true, 2 },
-            { GLOBAL_VIEW, "____globalView"_sv, true, 2 },
-            { INT_T, "int"_sv, true, 2 },
-            { CHAR_T, "char"_sv, true, 2 },
-            { FLOAT_T, "float"_sv, true, 2 },
-            { DOUBLE_T, "double"_sv, true, 2 },
-            { BUILTIN_AUTO_T, "__builtin_auto"_sv, true, 2 },
             { TYPE, "TYPE"_sv, false, 12 },
             { INTEGER, "[0-9]+"_sv, false, 13 },
             { FLOAT, "[0-9]+[.][0-9]*[f]"_sv, false, 13 },
             { DOUBLE, "[0-9]+[.][0-9]*"_sv, false, 13 },
             { IDENTIFIER, "[a-zA_Z_]+[a-zA-Z0-9_]*"_sv, false, 13 }
         },
+        keywords,
         {
             { 
                 { ADD, '+' },
@@ -15,13 +15,6 @@ namespace CL {
     CerberusLexerTemplate struct CerberusLexerImpl final : public CerberusLexer<>
     {
         CerberusLexerAccess;
-        Vector<token_t> m_tokens{};
-
-        constexpr auto yield(const token_t &token) -> bool override
-        {
-            m_tokens.emplace_back(token);
-            return true;
-        }
 
         constexpr auto error(const item_t &item, const string_view_t &repr)
             -> void override
@@ -34,15 +27,11 @@ namespace CL {
         {
             analysis::basic_syntax_error(*head(), token->repr, "Syntax error: ");
         }
-
-        constexpr auto finish() -> void override
-        {}
     };
 
     struct Parser
     {
-        size_t current_token_id{};
-        token_t *current_token;
+        token_t current_token{};
         CerberusLexerImpl<> cerberus_lexer{};
         ParserNode *global_view_node{ ParserNode::construct_node(
             global_view_token) };
@@ -76,15 +65,20 @@ namespace CL {
             return ParserNode::construct_node(auto_token);
         }
 
+        // tokens are scanned on demand, when yacc asks for them
         auto next_token() -> token_t *
         {
-            current_token = &cerberus_lexer.m_tokens[current_token_id++];
-            return current_token;
+            const token_t *token = cerberus_lexer.next_token();
+
+            if (token != nullptr) {
+                current_token = *token;
+            }
+            return &current_token;
         }
 
-        auto operator()() const -> token_t *
+        auto operator()() -> token_t *
         {
-            return current_token;
+            return &current_token;
         }
 
         auto print()
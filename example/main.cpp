@@ -10,6 +10,8 @@
 #include <cerberus/deque2.hpp>
 #include <cerberus/range.hpp>
 #include <cerberus/benchmark.hpp>
+#include <cerberus/analyzation/lex/driver.hpp>
+#include <cerberus/analyzation/lex/stream.hpp>
 
 using namespace cerb::literals;
 using namespace std::string_view_literals;
@@ -102,8 +104,68 @@ auto deque_test() -> int
 
 
 
-auto main() -> int
+auto lex_files(int argc, char *argv[]) -> int
 {
+    std::vector<std::string> filenames(argv + 1, argv + argc);
+    cerb::lex::ParallelLexer<Lex4C<>, cerb::lex::OffsetTokenCollector> lexer{};
+    auto result = lexer.lex_files(filenames);
+
+    for (const auto &file : result.files) {
+        if (!file.succeeded()) {
+            try {
+                std::rethrow_exception(file.exception);
+            } catch (const std::exception &e) {
+                fmt::print("{}\n", e.what());
+            }
+            continue;
+        }
+
+        const auto &statistics = file.lexer->statistics();
+        fmt::print(
+            "{:<32} {:>10} bytes {:>8} tokens {:e}\n", file.lexer->filename(),
+            statistics.bytes, statistics.tokens, statistics.time.count());
+    }
+
+    fmt::print(
+        "total: {} bytes, {} tokens, lexing time {:e}, wall time {:e}, workers {}\n",
+        result.total.bytes, result.total.tokens, result.total.time.count(),
+        result.wall_time.count(), lexer.workers());
+
+    return 0;
+}
+
+// lexes standard input by chunks, so input may be bigger than memory
+auto lex_stdin() -> int
+{
+    cerb::lex::TokenCollector<Lex4C<>> lexer{ "", "" };
+    cerb::lex::StreamLexer stream{ lexer, cerb::lex::StreamReader<char>{ std::cin },
+                                   "stdin" };
+    size_t tokens = 0;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+
+    for (auto token = stream.next_token(); token != nullptr;
+         token      = stream.next_token()) {
+        ++tokens;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - begin;
+    fmt::print("stdin: {} tokens {:e}\n", tokens, elapsed.count());
+
+    return 0;
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+    if (argc == 2 && argv[1] == "-"sv) {
+        return lex_stdin();
+    }
+
+    if (argc > 1) {
+        return lex_files(argc, argv);
+    }
+
     Lex4CImp C_lexer{};
     auto begin = std::chrono::high_resolution_clock::now();
     C_lexer.scan(input, "stdio");
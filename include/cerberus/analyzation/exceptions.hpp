@@ -71,11 +71,17 @@ namespace cerb::analysis {
         const auto &item, const cerb::basic_string_view<CharT> &repr,
         const char *message) -> void
     {
-        const auto &pos                                 = item.get_token_pos();
-        const auto &line                                = item.get_line();
+        const auto &pos  = item.get_token_pos();
+        const auto &line = item.get_line();
+        auto begin       = cerb::max(line.begin(), item.get_begin_of_token());
+
+        // line may end before the token, if it has been found after a string
+        // literal with a new line inside
         const cerb::basic_string_view<CharT> final_repr = {
-            cerb::max(line.begin(), item.get_begin_of_token()),
-            cerb::min(line.end(), item.get_begin_of_token() + repr.size() + 40)
+            begin,
+            cerb::max(
+                begin,
+                cerb::min(line.end(), item.get_begin_of_token() + repr.size() + 40))
         };
         auto repr_offset =
             static_cast<int>(item.get_begin_of_token() - final_repr.begin());
@@ -0,0 +1,115 @@
+#ifndef CERBERUS_LEX_BYTE_CLASSES_HPP
+#define CERBERUS_LEX_BYTE_CLASSES_HPP
+
+#include <array>
+#include <limits>
+#include <cerberus/types.h>
+
+namespace cerb::lex {
+    /**
+     * @brief partition of 256 bytes into equivalence classes: bytes of one class
+     * belong to the same sets of every refining set (range, terminal, edge), so
+     * matchers can work with dense class ids instead of bytes. Class of byte 0 is
+     * 0, other classes are numbered in order of their first bytes
+     */
+    class ByteClasses
+    {
+    public:
+        using mask_t = u64;
+
+        static constexpr size_t Bytes       = 256;
+        static constexpr size_t MaskClasses = std::numeric_limits<mask_t>::digits;
+
+    private:
+        std::array<u8, Bytes> m_classes{};
+        size_t m_size{ 1 };
+
+    public:
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_size;
+        }
+
+        CERBLIB_DECL auto table() const noexcept -> const std::array<u8, Bytes> &
+        {
+            return m_classes;
+        }
+
+        CERBLIB_DECL auto operator[](size_t byte) const noexcept -> u8
+        {
+            return m_classes[byte];
+        }
+
+        /**
+         * @brief checks, that set of classes fits in mask_t
+         */
+        CERBLIB_DECL auto fits_mask() const noexcept -> bool
+        {
+            return m_size <= MaskClasses;
+        }
+
+        /**
+         * @brief splits classes, so that every class is either inside of set
+         * or outside of it
+         * @param contains predicate, which tells whether byte is in the set
+         */
+        template<typename Predicate>
+        constexpr auto refine(Predicate &&contains) -> void
+        {
+            // new id of (old class, is in the set)
+            std::array<u16, Bytes * 2> ids{};
+            u16 size = 0;
+
+            ids.fill(std::numeric_limits<u16>::max());
+
+            CERBLIB_UNROLL_N(4)
+            for (size_t byte = 0; byte != Bytes; ++byte) {
+                size_t key = m_classes[byte] * 2U + (contains(byte) ? 1U : 0U);
+
+                if (ids[key] == std::numeric_limits<u16>::max()) {
+                    ids[key] = size++;
+                }
+
+                m_classes[byte] = static_cast<u8>(ids[key]);
+            }
+
+            m_size = size;
+        }
+
+        /**
+         * @brief mask of classes, which are inside of the set. Set must be
+         * refined before and classes must fit in mask_t
+         */
+        template<typename Predicate>
+        CERBLIB_DECL auto mask(Predicate &&contains) const -> mask_t
+        {
+            mask_t result = 0;
+
+            CERBLIB_UNROLL_N(4)
+            for (size_t byte = 0; byte != Bytes; ++byte) {
+                if (contains(byte)) {
+                    result |= mask_t{ 1 } << m_classes[byte];
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief representative byte (the first one) of every class
+         */
+        CERBLIB_DECL auto representatives() const -> std::array<u8, Bytes>
+        {
+            std::array<u8, Bytes> result{};
+
+            CERBLIB_UNROLL_N(4)
+            for (size_t byte = Bytes; byte != 0; --byte) {
+                result[m_classes[byte - 1]] = static_cast<u8>(byte - 1);
+            }
+
+            return result;
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_BYTE_CLASSES_HPP */
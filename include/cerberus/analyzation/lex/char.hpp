@@ -1,6 +1,7 @@
 #ifndef CERBERUS_CHAR_HPP
 #define CERBERUS_CHAR_HPP
 
+#include <type_traits>
 #include <cerberus/types.h>
 
 namespace cerb::lex {
@@ -10,16 +11,18 @@ namespace cerb::lex {
         return chr == static_cast<CharT>(0);
     }
 
+    // characters are compared as unsigned, bytes of UTF-8 are not layout
     template<typename CharT>
     constexpr auto is_layout(CharT chr) -> bool
     {
-        return !is_end_of_input(chr) && chr <= static_cast<CharT>(' ');
+        return !is_end_of_input(chr) &&
+               static_cast<std::make_unsigned_t<CharT>>(chr) <= ' ';
     }
 
     template<typename CharT>
     constexpr auto is_layout_or_end_of_input(CharT chr) -> bool
     {
-        return chr <= static_cast<CharT>(' ');
+        return static_cast<std::make_unsigned_t<CharT>>(chr) <= ' ';
     }
 
     template<typename CharT>
@@ -0,0 +1,103 @@
+#ifndef CERBERUS_LEX_CHAR_CLASS_HPP
+#define CERBERUS_LEX_CHAR_CLASS_HPP
+
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <cerberus/pair.hpp>
+#include <cerberus/math.hpp>
+#include <cerberus/types.h>
+#include <cerberus/bitmap.hpp>
+
+namespace cerb::lex {
+    /**
+     * @brief set of characters: bitmap for the first 256 characters (they are
+     * the most frequent, so the check is as fast as with the whole bitmap) and
+     * sorted disjoint intervals for the others. Characters are code points for
+     * UTF-8 input and code units for wider characters. Unicode classes may
+     * consist of hundreds of intervals, so they are not limited
+     */
+    class CharClass
+    {
+        using interval_t = Pair<u32, u32>;
+
+        ConstBitmap<1, 256> m_bitmap{};
+        std::vector<interval_t> m_intervals{};
+
+        CERBLIB_DECL auto in_intervals(u32 chr) const -> bool
+        {
+            size_t first = 0;
+            size_t last  = m_intervals.size();
+
+            CERBLIB_UNROLL_N(1)
+            while (first < last) {
+                size_t middle = first + (last - first) / 2;
+
+                if (m_intervals[middle].second < chr) {
+                    first = middle + 1;
+                } else {
+                    last = middle;
+                }
+            }
+
+            return first != m_intervals.size() && m_intervals[first].first <= chr;
+        }
+
+        // intervals, which intersect or touch the new one, are merged with it.
+        // Intervals begin after 255, so first - 1 does not overflow
+        constexpr auto add_interval(u32 first, u32 last) -> void
+        {
+            auto begin = std::partition_point(
+                m_intervals.begin(), m_intervals.end(),
+                [first](const interval_t &interval) {
+                    return interval.second < first - 1;
+                });
+            auto end = begin;
+
+            while (end != m_intervals.end() && end->first - 1 <= last) {
+                first = cerb::min(first, end->first);
+                last  = cerb::max(last, end->second);
+                ++end;
+            }
+
+            begin = m_intervals.erase(begin, end);
+            m_intervals.insert(begin, { first, last });
+        }
+
+    public:
+        CERBLIB_DECL auto contains(u32 chr) const -> bool
+        {
+            if (chr < 256) [[likely]] {
+                return m_bitmap.template at<0>(chr) == 1;
+            }
+
+            return in_intervals(chr);
+        }
+
+        /**
+         * @brief intervals of characters, which are not in the bitmap
+         */
+        CERBLIB_DECL auto intervals() const -> std::span<const interval_t>
+        {
+            return m_intervals;
+        }
+
+        /**
+         * @brief adds characters from @p first to @p last (inclusive)
+         */
+        constexpr auto add(u32 first, u32 last) -> void
+        {
+            for (u32 chr = first; chr <= cerb::min(last, 255U); ++chr) {
+                m_bitmap.template set<1, 0>(chr);
+            }
+
+            first = cerb::max(first, 256U);
+
+            if (first <= last) {
+                add_interval(first, last);
+            }
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_CHAR_CLASS_HPP */
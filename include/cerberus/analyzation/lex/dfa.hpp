@@ -0,0 +1,762 @@
+#ifndef CERBERUS_DFA_HPP
+#define CERBERUS_DFA_HPP
+
+#include <map>
+#include <tuple>
+#include <bitset>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cerberus/pair.hpp>
+#include <cerberus/types.h>
+#include <cerberus/string_view.hpp>
+#include <cerberus/analyzation/lex/utf8.hpp>
+#include <cerberus/analyzation/lex/byte_classes.hpp>
+#include <cerberus/analyzation/lex/dot_item.hpp>
+
+namespace cerb::lex {
+    /**
+     * @brief non-owning view over a combined lexer DFA
+     * State 0 is dead state, state 1 is start state. Bytes are mapped to their
+     * classes, table has one column for every class in every state. Accepting
+     * states have priority different from NotAccepting, their token type is
+     * stored in accept. Flags of state tell, that a terminal ends in it and that
+     * the accepted token must be followed by layout, comment, terminal or end of
+     * input (like DotItem checks the end of its token). Like DotItem, rule may
+     * stop before its mandatory ranges, if layout, comment or end of input
+     * follows: such partial match is stored in partial, when it wins over the
+     * full one.
+     *
+     * @tparam TokenType type of tokens
+     */
+    template<typename TokenType>
+    struct Dfa
+    {
+        using state_t = u16;
+
+        static constexpr size_t Alphabet       = 256;
+        static constexpr state_t DeadState     = 0;
+        static constexpr state_t StartState    = 1;
+        static constexpr u32 NotAccepting      = std::numeric_limits<u32>::max();
+        static constexpr u8 TerminalFlag       = 1U;
+        static constexpr u8 BoundedFlag        = 2U;
+        static constexpr u8 PartialFlag        = 4U;
+
+        /**
+         * @brief the longest match: its length (0 if there is no match), type of
+         * full match (if there is one) and whether the end of token must be
+         * checked, type of partial match, which is taken before layout only
+         */
+        struct Match
+        {
+            size_t length{ 0 };
+            TokenType type{};
+            TokenType partial_type{};
+            bool full{ false };
+            bool bounded{ false };
+            bool partial{ false };
+        };
+
+        const state_t *transitions{ nullptr };
+        const u8 *classes{ nullptr };
+        size_t columns{ 0 };
+        const TokenType *accept{ nullptr };
+        const TokenType *partial{ nullptr };
+        const u32 *priority{ nullptr };
+        const u8 *flags{ nullptr };
+        size_t states{ 0 };
+
+    public:
+        CERBLIB_DECL auto empty() const noexcept -> bool
+        {
+            return states == 0;
+        }
+
+        CERBLIB_DECL auto next(state_t state, size_t chr) const noexcept -> state_t
+        {
+            return transitions[state * columns + classes[chr]];
+        }
+
+        CERBLIB_DECL auto is_accepting(state_t state) const noexcept -> bool
+        {
+            return priority[state] != NotAccepting || has_flag(state, PartialFlag);
+        }
+
+        CERBLIB_DECL auto has_flag(state_t state, u8 flag) const noexcept -> bool
+        {
+            return (flags[state] & flag) != 0;
+        }
+
+        /**
+         * @brief finds the longest token at the beginning of input
+         *
+         * @param input text to scan
+         * @return the longest match
+         */
+        template<typename CharT>
+        CERBLIB_DECL auto match(const basic_string_view<CharT> &input) const -> Match
+        {
+            state_t state          = StartState;
+            state_t accepted_state = DeadState;
+            size_t length          = 0;
+            size_t size            = input.size();
+
+            CERBLIB_UNROLL_N(4)
+            for (size_t i = 0; i < size; ++i) {
+                auto chr = to_unsigned(input[i]);
+
+                if (chr >= Alphabet) {
+                    break;
+                }
+
+                state = next(state, chr);
+
+                if (state == DeadState) {
+                    break;
+                }
+
+                if (is_accepting(state)) {
+                    accepted_state = state;
+                    length         = i + 1;
+                }
+            }
+
+            return { length,
+                     accept[accepted_state],
+                     partial[accepted_state],
+                     priority[accepted_state] != NotAccepting,
+                     has_flag(accepted_state, BoundedFlag),
+                     has_flag(accepted_state, PartialFlag) };
+        }
+
+        /**
+         * @brief checks, that any terminal begins at @p index of @p input
+         */
+        template<typename CharT>
+        CERBLIB_DECL auto begins_terminal(
+            const basic_string_view<CharT> &input, size_t index) const -> bool
+        {
+            state_t state = StartState;
+            size_t size   = input.size();
+
+            CERBLIB_UNROLL_N(2)
+            for (; index < size; ++index) {
+                auto chr = to_unsigned(input[index]);
+
+                if (chr >= Alphabet) {
+                    return false;
+                }
+
+                state = next(state, chr);
+
+                if (state == DeadState) {
+                    return false;
+                }
+
+                if (has_flag(state, TerminalFlag)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    public:
+        constexpr Dfa()  = default;
+        constexpr ~Dfa() = default;
+
+        constexpr Dfa(const Dfa &)     = default;
+        constexpr Dfa(Dfa &&) noexcept = default;
+
+        constexpr Dfa(
+            const state_t *transitions_, const u8 *classes_, size_t columns_,
+            const TokenType *accept_, const TokenType *partial_, const u32 *priority_,
+            const u8 *flags_, size_t states_) noexcept
+          : transitions(transitions_), classes(classes_), columns(columns_),
+            accept(accept_), partial(partial_), priority(priority_), flags(flags_),
+            states(states_)
+        {}
+
+        constexpr auto operator=(const Dfa &) -> Dfa & = default;
+        constexpr auto operator=(Dfa &&) noexcept -> Dfa & = default;
+    };
+
+    /**
+     * @brief storage for tables, which are generated by DfaBuilder
+     */
+    template<typename TokenType>
+    struct DfaTables
+    {
+        using dfa_t   = Dfa<TokenType>;
+        using state_t = typename dfa_t::state_t;
+
+        std::vector<state_t> transitions{};
+        ByteClasses classes{};
+        std::vector<TokenType> accept{};
+        std::vector<TokenType> partial{};
+        std::vector<u32> priority{};
+        std::vector<u8> flags{};
+
+    public:
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return accept.size();
+        }
+
+        CERBLIB_DECL auto columns() const noexcept -> size_t
+        {
+            return classes.size();
+        }
+
+        CERBLIB_DECL auto view() const noexcept -> dfa_t
+        {
+            return { transitions.data(), classes.table().data(), columns(),
+                     accept.data(),      partial.data(),          priority.data(),
+                     flags.data(),       size() };
+        }
+    };
+
+    /**
+     * @brief compiles DotItems and terminals into one minimized DFA.
+     * Conflicts between rules, which accept the same text, are resolved by
+     * priority (lower value wins) and then by token type, like
+     * LexicalAnalyzer orders its items.
+     */
+    template<typename CharT, typename TokenType>
+    class DfaBuilder
+    {
+        using dfa_t    = Dfa<TokenType>;
+        using state_t  = typename dfa_t::state_t;
+        using tables_t = DfaTables<TokenType>;
+        using char_set = std::bitset<dfa_t::Alphabet>;
+
+        static constexpr size_t Alphabet = dfa_t::Alphabet;
+        static constexpr u32 NotAccepting = dfa_t::NotAccepting;
+
+        struct NfaState
+        {
+            std::vector<Pair<char_set, size_t>> edges{};
+            std::vector<size_t> epsilon{};
+            TokenType type{};
+            u32 priority{ NotAccepting };
+            TokenType partial_type{};
+            u32 partial_priority{ NotAccepting };// rule may stop here before layout
+            bool bounded{ false };
+            bool terminal{ false };
+        };
+
+        std::vector<NfaState> m_nfa{ NfaState{} };// state 0 is start state
+        bool m_utf8{ false };// narrow characters after ASCII are UTF-8
+
+        CERBLIB_DECL static auto accepts_before(
+            u32 lhs_priority, TokenType lhs_type, u32 rhs_priority,
+            TokenType rhs_type) -> bool
+        {
+            if (lhs_priority == rhs_priority) {
+                return lhs_type < rhs_type;
+            }
+            return lhs_priority < rhs_priority;
+        }
+
+        constexpr auto new_state() -> size_t
+        {
+            m_nfa.emplace_back();
+            return m_nfa.size() - 1;
+        }
+
+        constexpr auto
+            set_accepting(size_t state, TokenType type, u32 priority, bool bounded)
+                -> void
+        {
+            auto &nfa_state = m_nfa[state];
+
+            if (nfa_state.priority == NotAccepting ||
+                accepts_before(priority, type, nfa_state.priority, nfa_state.type)) {
+                nfa_state.type     = type;
+                nfa_state.priority = priority;
+                nfa_state.bounded  = bounded;
+            }
+        }
+
+        constexpr auto set_partial(size_t state, TokenType type, u32 priority) -> void
+        {
+            auto &nfa_state = m_nfa[state];
+
+            if (nfa_state.partial_priority == NotAccepting ||
+                accepts_before(
+                    priority, type, nfa_state.partial_priority,
+                    nfa_state.partial_type)) {
+                nfa_state.partial_type     = type;
+                nfa_state.partial_priority = priority;
+            }
+        }
+
+        static auto char2set(CharT chr) -> char_set
+        {
+            char_set result{};
+            auto index = to_unsigned(chr);
+
+            if (index < Alphabet) {
+                result.set(index);
+            }
+            return result;
+        }
+
+        /*
+         * edges from @p from to @p to for every character of @p chars. In UTF-8
+         * input code points after ASCII become chains of byte ranges. Wider
+         * characters after the alphabet can't be matched by DFA
+         */
+        template<typename Class>
+        auto add_class(size_t from, size_t to, const Class &chars) -> void
+        {
+            size_t single_bytes = m_utf8 ? 0x80 : Alphabet;
+            char_set bytes{};
+
+            CERBLIB_UNROLL_N(4)
+            for (size_t chr = 0; chr < single_bytes; ++chr) {
+                bytes.set(chr, chars.contains(static_cast<u32>(chr)));
+            }
+
+            m_nfa[from].edges.emplace_back(bytes, to);
+
+            if (m_utf8) {
+                auto add_sequences = [this, from, to](u32 first, u32 last) {
+                    utf8::for_each_sequence(
+                        first, last, [this, from, to](const auto &sequence, size_t size) {
+                            add_byte_chain(from, to, sequence, size);
+                        });
+                };
+
+                u32 run_begin = 0;
+
+                CERBLIB_UNROLL_N(1)
+                for (u32 chr = 0x80; chr <= 0x100; ++chr) {
+                    bool contains = chr != 0x100 && chars.contains(chr);
+
+                    if (contains && run_begin == 0) {
+                        run_begin = chr;
+                    } else if (!contains && run_begin != 0) {
+                        add_sequences(run_begin, chr - 1);
+                        run_begin = 0;
+                    }
+                }
+
+                CERBLIB_UNROLL_N(1)
+                for (const auto &interval : chars.intervals()) {
+                    add_sequences(interval.first, interval.second);
+                }
+            }
+        }
+
+        auto add_byte_chain(
+            size_t from, size_t to, const utf8::sequence_t &sequence, size_t size)
+            -> void
+        {
+            size_t state = from;
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != size; ++i) {
+                char_set bytes{};
+                size_t next_state = i + 1 == size ? to : new_state();
+
+                for (size_t chr = sequence[i].first; chr <= sequence[i].second; ++chr) {
+                    bytes.set(chr);
+                }
+
+                m_nfa[state].edges.emplace_back(bytes, next_state);
+                state = next_state;
+            }
+        }
+
+        // returns the last state of sequence (0 for empty one)
+        auto add_sequence(
+            const basic_string_view<CharT> &str, TokenType type, u32 priority,
+            bool bounded) -> size_t
+        {
+            size_t state = 0;
+
+            CERBLIB_UNROLL_N(2)
+            for (const CharT chr : str) {
+                size_t next_state = new_state();
+                m_nfa[state].edges.emplace_back(char2set(chr), next_state);
+                state = next_state;
+            }
+
+            if (state != 0) {
+                set_accepting(state, type, priority, bounded);
+            }
+            return state;
+        }
+
+        auto closure(std::vector<size_t> &states) const -> void
+        {
+            std::vector<bool> visited(m_nfa.size(), false);
+            std::vector<size_t> stack = states;
+
+            CERBLIB_UNROLL_N(2)
+            for (auto state : states) {
+                visited[state] = true;
+            }
+
+            while (!stack.empty()) {
+                auto state = stack.back();
+                stack.pop_back();
+
+                CERBLIB_UNROLL_N(2)
+                for (auto target : m_nfa[state].epsilon) {
+                    if (!visited[target]) {
+                        visited[target] = true;
+                        states.push_back(target);
+                        stack.push_back(target);
+                    }
+                }
+            }
+
+            std::sort(states.begin(), states.end());
+        }
+
+        // accepting state of rule, which wins in @p states (nullptr if none)
+        auto accepting_of(const std::vector<size_t> &states) const
+            -> const NfaState *
+        {
+            const NfaState *result = nullptr;
+
+            CERBLIB_UNROLL_N(2)
+            for (auto state : states) {
+                const auto &nfa_state = m_nfa[state];
+
+                if (nfa_state.priority != NotAccepting &&
+                    (result == nullptr ||
+                     accepts_before(
+                         nfa_state.priority, nfa_state.type, result->priority,
+                         result->type))) {
+                    result = &nfa_state;
+                }
+            }
+            return result;
+        }
+
+        /*
+         * partial match of rule, which wins over @p accepting in @p states
+         * (nullptr if none), full match wins over partial one of the same rule
+         */
+        auto partial_of(const std::vector<size_t> &states, const NfaState *accepting)
+            const -> const NfaState *
+        {
+            const NfaState *result = nullptr;
+
+            CERBLIB_UNROLL_N(2)
+            for (auto state : states) {
+                const auto &nfa_state = m_nfa[state];
+
+                if (nfa_state.partial_priority != NotAccepting &&
+                    (result == nullptr ||
+                     accepts_before(
+                         nfa_state.partial_priority, nfa_state.partial_type,
+                         result->partial_priority, result->partial_type))) {
+                    result = &nfa_state;
+                }
+            }
+
+            if (result == nullptr || accepting == nullptr ||
+                accepts_before(
+                    result->partial_priority, result->partial_type,
+                    accepting->priority, accepting->type)) {
+                return result;
+            }
+            return nullptr;
+        }
+
+        auto flags_of(
+            const std::vector<size_t> &states, const NfaState *accepting,
+            const NfaState *partial) const -> u8
+        {
+            u8 result = 0;
+
+            if (accepting != nullptr && accepting->bounded) {
+                result |= dfa_t::BoundedFlag;
+            }
+
+            if (partial != nullptr) {
+                result |= dfa_t::PartialFlag;
+            }
+
+            CERBLIB_UNROLL_N(2)
+            for (auto state : states) {
+                if (m_nfa[state].terminal) {
+                    result |= dfa_t::TerminalFlag;
+                }
+            }
+            return result;
+        }
+
+        /*
+         * bytes, which are not distinguished by any edge, go to the same states,
+         * so the automaton needs only one column for all of them
+         */
+        auto byte_classes() const -> ByteClasses
+        {
+            ByteClasses result{};
+
+            CERBLIB_UNROLL_N(1)
+            for (const auto &state : m_nfa) {
+                CERBLIB_UNROLL_N(1)
+                for (const auto &edge : state.edges) {
+                    result.refine([&edge](size_t byte) { return edge.first.test(byte); });
+                }
+            }
+
+            return result;
+        }
+
+        /*
+         * subset construction on byte classes, state 0 of the result is dead state
+         * and state 1 is start state
+         */
+        auto determinize() const -> tables_t
+        {
+            tables_t result{ .classes = byte_classes() };
+            std::map<std::vector<size_t>, size_t> ids{};
+            std::vector<std::vector<size_t>> subsets{ {}, { 0 } };
+            auto representatives = result.classes.representatives();
+
+            closure(subsets[1]);
+            ids.emplace(subsets[0], 0);
+            ids.emplace(subsets[1], 1);
+
+            for (size_t i = 0; i < subsets.size(); ++i) {
+                const NfaState *accepting = accepting_of(subsets[i]);
+                const NfaState *partial   = partial_of(subsets[i], accepting);
+                result.priority.push_back(
+                    accepting == nullptr ? NotAccepting : accepting->priority);
+                result.accept.push_back(
+                    accepting == nullptr ? TokenType{} : accepting->type);
+                result.partial.push_back(
+                    partial == nullptr ? TokenType{} : partial->partial_type);
+                result.flags.push_back(flags_of(subsets[i], accepting, partial));
+
+                for (size_t column = 0; column < result.columns(); ++column) {
+                    std::vector<size_t> target{};
+                    size_t chr = representatives[column];
+
+                    for (auto state : subsets[i]) {
+                        for (const auto &edge : m_nfa[state].edges) {
+                            if (edge.first.test(chr)) {
+                                target.push_back(edge.second);
+                            }
+                        }
+                    }
+
+                    closure(target);
+                    target.erase(
+                        std::unique(target.begin(), target.end()), target.end());
+
+                    auto [iterator, inserted] = ids.emplace(target, subsets.size());
+
+                    if (inserted) {
+                        subsets.push_back(std::move(target));
+                    }
+
+                    result.transitions.push_back(
+                        static_cast<state_t>(iterator->second));
+                }
+
+                if (subsets.size() > std::numeric_limits<state_t>::max()) {
+                    throw std::out_of_range("DFA has too many states!");
+                }
+            }
+
+            return result;
+        }
+
+        /*
+         * Moore's partition refinement: states are split until all states
+         * in a block have equal acceptance and go to the same blocks
+         */
+        static auto minimize(const tables_t &dfa) -> tables_t
+        {
+            size_t size    = dfa.size();
+            size_t columns = dfa.columns();
+            std::vector<size_t> block(size);
+            size_t blocks_count = 0;
+
+            {
+                std::map<std::tuple<u32, TokenType, u8, TokenType>, size_t> initial{};
+
+                for (size_t i = 0; i < size; ++i) {
+                    std::tuple<u32, TokenType, u8, TokenType> key{
+                        dfa.priority[i], dfa.accept[i], dfa.flags[i], dfa.partial[i]
+                    };
+
+                    if (dfa.priority[i] == NotAccepting) {
+                        std::get<1>(key) = TokenType{};
+                    }
+
+                    auto [iterator, inserted] = initial.emplace(key, initial.size());
+                    block[i]                  = iterator->second;
+                }
+                blocks_count = initial.size();
+            }
+
+            while (true) {
+                std::map<std::vector<size_t>, size_t> signatures{};
+                std::vector<size_t> new_block(size);
+
+                for (size_t i = 0; i < size; ++i) {
+                    std::vector<size_t> signature{ block[i] };
+                    signature.reserve(columns + 1);
+
+                    CERBLIB_UNROLL_N(4)
+                    for (size_t column = 0; column < columns; ++column) {
+                        signature.push_back(block[dfa.transitions[i * columns + column]]);
+                    }
+
+                    auto [iterator, inserted] =
+                        signatures.emplace(std::move(signature), signatures.size());
+                    new_block[i] = iterator->second;
+                }
+
+                block = std::move(new_block);
+
+                if (signatures.size() == blocks_count) {
+                    break;
+                }
+                blocks_count = signatures.size();
+            }
+
+            /*
+             * renumber blocks so that dead and start states stay on their places,
+             * other states are numbered in order of discovery from start state
+             */
+            std::vector<size_t> order(blocks_count, std::numeric_limits<size_t>::max());
+            std::vector<size_t> representative{ dfa_t::DeadState, dfa_t::StartState };
+
+            order[block[dfa_t::DeadState]] = 0;
+            order[block[dfa_t::StartState]] = 1;
+
+            for (size_t i = 1; i < representative.size(); ++i) {
+                CERBLIB_UNROLL_N(4)
+                for (size_t column = 0; column < columns; ++column) {
+                    auto target = dfa.transitions[representative[i] * columns + column];
+
+                    if (order[block[target]] == std::numeric_limits<size_t>::max()) {
+                        order[block[target]] = representative.size();
+                        representative.push_back(target);
+                    }
+                }
+            }
+
+            tables_t result{ .classes = dfa.classes };
+
+            for (auto state : representative) {
+                result.priority.push_back(dfa.priority[state]);
+                result.accept.push_back(dfa.accept[state]);
+                result.partial.push_back(dfa.partial[state]);
+                result.flags.push_back(dfa.flags[state]);
+
+                CERBLIB_UNROLL_N(4)
+                for (size_t column = 0; column < columns; ++column) {
+                    result.transitions.push_back(static_cast<state_t>(
+                        order[block[dfa.transitions[state * columns + column]]]));
+                }
+            }
+
+            return result;
+        }
+
+    public:
+        /**
+         * @brief adds DotItem's rule to the automaton. Like DotItem, rule may
+         * stop after any of its ranges, if layout, comment or end of input
+         * follows, so all states of rule, but the first one, accept partially
+         *
+         * @param item initialized DotItem (word or range based)
+         */
+        template<typename Item>
+        auto add_item(const Item &item) -> void
+        {
+            if (item.is_word()) {
+                add_sequence(item.get_word(), item.get_type(), item.priority, false);
+                return;
+            }
+
+            size_t state = 0;
+
+            for (const auto &range : item.get_ranges()) {
+                size_t next_state = new_state();
+
+                switch (range.rule) {
+                case BASIC:
+                    add_class(state, next_state, item.get_chars(range));
+                    break;
+
+                case OPTIONAL:
+                    add_class(state, next_state, item.get_chars(range));
+                    m_nfa[state].epsilon.push_back(next_state);
+                    break;
+
+                case ONE_OR_MORE_TIMES:
+                    add_class(state, next_state, item.get_chars(range));
+                    add_class(next_state, next_state, item.get_chars(range));
+                    break;
+
+                default:// ZERO_OR_MORE_TIMES
+                    m_nfa[state].epsilon.push_back(next_state);
+                    add_class(next_state, next_state, item.get_chars(range));
+                    break;
+                }
+
+                set_partial(next_state, item.get_type(), item.priority);
+                state = next_state;
+            }
+
+            if (state != 0) {
+                set_accepting(state, item.get_type(), item.priority, true);
+            }
+        }
+
+        /**
+         * @brief adds word (keyword), which is matched as it is, but only if it
+         * is followed by the end of token, like identifier, which it is taken from
+         */
+        auto add_word(const basic_string_view<CharT> &repr, TokenType type, u32 priority)
+            -> void
+        {
+            add_sequence(repr, type, priority, true);
+        }
+
+        /**
+         * @brief adds terminal (operator) to the automaton
+         * Terminals have the highest priority.
+         */
+        auto add_terminal(TokenType type, const basic_string_view<CharT> &repr)
+            -> void
+        {
+            m_nfa[add_sequence(repr, type, 0, false)].terminal = !repr.empty();
+        }
+
+        template<typename Checker>
+        auto add_terminals(const Checker &checker) -> void
+        {
+            CERBLIB_UNROLL_N(2)
+            for (const auto &terminal : checker.terminals()) {
+                add_terminal(terminal.type, terminal.repr());
+            }
+        }
+
+        CERBLIB_DECL auto build() const -> tables_t
+        {
+            return minimize(determinize());
+        }
+
+    public:
+        explicit DfaBuilder(Encoding encoding = Encoding::BYTES)
+          : m_utf8(sizeof(CharT) == 1 && encoding == Encoding::UTF8)
+        {}
+
+        ~DfaBuilder() = default;
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_DFA_HPP */
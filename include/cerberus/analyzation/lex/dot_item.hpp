@@ -1,6 +1,7 @@
 #ifndef CERBERUS_DOT_ITEM_HPP
 #define CERBERUS_DOT_ITEM_HPP
 
+#include <array>
 #include <cerberus/map.hpp>
 #include <cerberus/set.hpp>
 #include <cerberus/vector.hpp>
@@ -8,6 +9,10 @@
 #include <cerberus/analyzation/lex/file.hpp>
 #include <cerberus/analyzation/lex/token.hpp>
 #include <cerberus/analyzation/lex/char.hpp>
+#include <cerberus/analyzation/lex/simd.hpp>
+#include <cerberus/analyzation/lex/utf8.hpp>
+#include <cerberus/analyzation/lex/char_class.hpp>
+#include <cerberus/analyzation/lex/byte_classes.hpp>
 #include <cerberus/string_view.hpp>
 #include <cerberus/analyzation/lex/lex_string.hpp>
 
@@ -31,6 +36,16 @@ namespace cerb::lex {
         SCAN_FINISHED,
     };
 
+    /**
+     * @brief encoding of narrow rules and input. By default every byte is a
+     * character, UTF-8 decodes multibyte sequences into code points
+     */
+    enum struct Encoding : u8
+    {
+        BYTES,
+        UTF8
+    };
+
     constexpr gl::Map<ItemState, cerb::string_view, 4> ItemStateRepr{
         { UNABLE_TO_MATCH, "UNABLE_TO_MATCH" },
         { NEED_TO_SCAN, "NEED_TO_SCAN" },
@@ -41,7 +56,7 @@ namespace cerb::lex {
     template<
         typename CharT, typename TokenType, bool MayThrow, size_t UID,
         bool AllowStringLiterals, bool AllowComments, size_t MaxTerminals,
-        size_t MaxSize4Terminals>
+        size_t MaxSize4Terminals, bool TrackPositions = true>
     struct DotItem
     {
         using string_checker_t = TerminalContainer<
@@ -84,6 +99,73 @@ namespace cerb::lex {
                 -> DotItemInitializer & = default;
         };
 
+        /**
+         * @brief scan state, which is shared by all items of one lexer
+         */
+        struct ScanContext
+        {
+            /*
+             * where the last skip of layout and comments stopped: after them or
+             * at the beginning of comment, which is not closed before the end
+             */
+            struct Skipped
+            {
+                typename string_view_t::iterator input{};
+                typename string_view_t::iterator line{};
+                position_t position{};
+            };
+
+            string_checker_t checker{};
+            string_view_t input{};
+            string_view_t current_line{};
+            string_view_t single_line_comment{};
+            string_view_t multiline_comment_begin{};
+            string_view_t multiline_comment_end{};
+            position_t global_position{};
+            ByteClasses classes{};// classes of characters before 256 for all ranges
+            std::array<bool, 256> comment_first_chars{};
+            Skipped skipped{};
+
+            constexpr auto set_comments(
+                const string_view_t &single_line,
+                const string_view_t &multiline_begin,
+                const string_view_t &multiline_end) -> void
+            {
+                single_line_comment     = single_line;
+                multiline_comment_begin = multiline_begin;
+                multiline_comment_end   = multiline_end;
+                comment_first_chars     = {};
+
+                CERBLIB_UNROLL_N(2)
+                for (const auto &comment : { single_line, multiline_begin }) {
+                    if (!comment.empty()) {
+                        comment_first_chars[to_unsigned(comment[0]) % 256] = true;
+                    }
+                }
+            }
+
+            // first check before comparing input with comments
+            CERBLIB_DECL auto may_begin_comment(CharT chr) const -> bool
+            {
+                if constexpr (sizeof(CharT) == 1) {
+                    return comment_first_chars[to_unsigned(chr)];
+                } else {
+                    return to_unsigned(chr) >= 256 ||
+                           comment_first_chars[to_unsigned(chr)];
+                }
+            }
+
+            CERBLIB_DECL auto begins_comment(size_t index, const string_view_t &str)
+                const -> bool
+            {
+                return may_begin_comment(str[index]) &&
+                       (check_substring(index, str, single_line_comment) ||
+                        check_substring(index, str, multiline_comment_begin));
+            }
+        };
+
+        using chars_t = CharClass;
+
     private:
         enum SkipStatus : u16
         {
@@ -92,6 +174,10 @@ namespace cerb::lex {
             MULTILINE_COMMENT
         };
 
+        /*
+         * scan state of range, its characters are kept apart with other cold
+         * data of item, so ranges of item fit in two cache lines
+         */
         struct Range
         {
             constexpr auto rebind() -> void
@@ -99,20 +185,19 @@ namespace cerb::lex {
                 times = 0;
             }
 
-            CERBLIB_DECL auto at(CharT index) const -> u8
-            {
-                return bitmap.template at<0>(to_unsigned(index));
-            }
-
-            CERBLIB_DECL auto operator[](CharT index) const -> u8
+            /*
+             * characters before 256 are checked by their class in the lexer-wide
+             * table, when classes fit in the mask, other ones by intervals
+             */
+            CERBLIB_DECL auto contains(
+                u32 chr, const ByteClasses &classes, const chars_t &chars) const
+                -> bool
             {
-                return at(index);
-            }
+                if (chr < ByteClasses::Bytes && classes.fits_mask()) [[likely]] {
+                    return ((class_mask >> classes[chr]) & 1U) != 0;
+                }
 
-            template<u8 Value>
-            constexpr auto set(CharT index) -> void
-            {
-                return bitmap.template set<1, 0>(to_unsigned(index));
+                return chars.contains(chr);
             }
 
             CERBLIB_DECL auto can_end() const -> bool
@@ -132,11 +217,11 @@ namespace cerb::lex {
                 }
             }
 
-            CERBLIB_DECL auto check(CharT elem) -> ItemState
+            CERBLIB_DECL auto
+                check(u32 elem, const ByteClasses &classes, const chars_t &chars)
+                    -> ItemState
             {
-                u8 contains = at(elem);
-
-                if (contains == 1) {
+                if (contains(elem, classes, chars)) {
                     ++times;
 
                     switch (rule) {
@@ -172,7 +257,7 @@ namespace cerb::lex {
         public:
             ItemRule rule{};
             size_t times{};
-            ConstBitmap<1, string_checker_t::MaxChars> bitmap{};
+            ByteClasses::mask_t class_mask{};
         };
 
         using storage_t = gl::Set<Range, MAX_RANGES, MayThrow>;
@@ -182,30 +267,23 @@ namespace cerb::lex {
         u32 priority{};
 
     private:
-        bool m_is_word{ false };
-
-        const TokenType m_token_type{};
-        size_t m_dot{};
-        size_t m_input_index{};
-
-        position_t m_token_pos{};
-        position_t m_current_pos{};
-
-        result_t result_of_check{};
-
-        string_view_t m_word_repr{};
+        // hot: state, which is changed or read on every character
+        ScanContext *m_context{ nullptr };
         storage_t m_ranges{};
         iterator m_current_range{ m_ranges.begin() };
-
+        size_t m_dot{};
         string_view_iterator m_token_begin{};
+        position_t m_current_pos{};
+        const TokenType m_token_type{};
+        bool m_is_word{ false };
+        const bool m_utf8{ false };
 
-        static inline string_checker_t m_checker{};
-        static inline string_view_t m_input{};
-        static inline string_view_t m_current_line{};
-        static inline string_view_t m_single_line_comment{};
-        static inline string_view_t m_multiline_comment_begin{};
-        static inline string_view_t m_multiline_comment_end{};
-        static inline position_t m_global_position{};
+        // cold: rule and the result, they are needed once per token
+        position_t m_token_pos{};
+        string_view_t m_word_repr{};
+        result_t result_of_check{};
+        std::array<chars_t, MAX_RANGES> m_chars{};
+        std::array<simd::Lookup, MAX_RANGES> m_lookups{};
 
     private:
         constexpr auto throw_if_can(bool condition, const char *message) -> void
@@ -217,6 +295,42 @@ namespace cerb::lex {
             }
         }
 
+        CERBLIB_DECL auto index_of(const Range &range) const -> size_t
+        {
+            return static_cast<size_t>(&range - &*m_ranges.begin());
+        }
+
+        /*
+         * repeated range takes the rest of its run at once in whole blocks, the
+         * end of run and characters after ASCII are left for scalar check
+         */
+        auto scan_run() -> void
+        {
+            if constexpr (simd::lookup_enabled<CharT>) {
+                const auto &input = m_context->input;
+                size_t run        = simd::count_in(
+                    m_lookups[index_of(*m_current_range)], input.begin() + m_dot,
+                    input.end());
+
+                m_current_range->times += run;
+                m_dot += run;
+                move_pos(run);
+            }
+        }
+
+        // lines and columns are counted only if lexer tracks positions
+        constexpr auto move_pos(size_t columns) -> void
+        {
+            if constexpr (TrackPositions) {
+                m_current_pos += columns;
+            }
+        }
+
+        constexpr auto chars_of(iterator range) -> chars_t &
+        {
+            return m_chars[static_cast<size_t>(range - m_ranges.begin())];
+        }
+
         constexpr auto check_range_rule(iterator current_range) -> void
         {
             throw_if_can(
@@ -226,10 +340,10 @@ namespace cerb::lex {
 
         constexpr auto end_of_input_check() -> ItemState
         {
+            const auto &context = *m_context;
+
             if (is_layout_or_end_of_input(get_char()) ||
-                (AllowComments &&
-                 (check_substring(m_dot, m_input, m_single_line_comment) ||
-                  check_substring(m_dot, m_input, m_multiline_comment_begin)))) {
+                (AllowComments && context.begins_comment(m_dot, context.input))) {
                 if (m_dot != 0 && can_end()) {
                     string_view_t repr = { m_token_begin, m_token_begin + m_dot };
                     result_of_check = { { repr, m_token_type, get_begin_of_token(),
@@ -239,7 +353,7 @@ namespace cerb::lex {
                 return UNABLE_TO_MATCH;
             }
 
-            auto terminal_repr = m_checker.check(m_dot, m_input);
+            auto terminal_repr = context.checker.check(m_dot, context.input);
             if (!terminal_repr.first.empty()) {
                 if (m_dot == 0) {
                     string_view_t repr = {
@@ -248,7 +362,7 @@ namespace cerb::lex {
                     result_of_check = { { repr, terminal_repr.second,
                                           get_begin_of_token(), m_token_pos } };
                     m_dot += terminal_repr.first.size();
-                    m_current_pos += terminal_repr.first.size();
+                    move_pos(terminal_repr.first.size());
                     return SCAN_FINISHED;
                 }
                 if (m_current_range == m_ranges.end() ||
@@ -263,7 +377,7 @@ namespace cerb::lex {
                                           get_begin_of_token(), m_current_pos } };
 
                     m_dot += terminal_repr.first.size();
-                    m_current_pos += terminal_repr.first.size();
+                    move_pos(terminal_repr.first.size());
                     return SCAN_FINISHED;
                 }
                 return UNABLE_TO_MATCH;
@@ -301,14 +415,61 @@ namespace cerb::lex {
             return m_dot;
         }
 
-        CERBLIB_DECL static auto empty() -> bool
+        CERBLIB_DECL auto get_type() const -> TokenType
+        {
+            return m_token_type;
+        }
+
+        CERBLIB_DECL auto is_word() const -> bool
+        {
+            return m_is_word;
+        }
+
+        CERBLIB_DECL auto get_word() const -> const string_view_t &
+        {
+            return m_word_repr;
+        }
+
+        CERBLIB_DECL auto get_ranges() const -> const storage_t &
+        {
+            return m_ranges;
+        }
+
+        CERBLIB_DECL auto get_chars(const Range &range) const -> const chars_t &
+        {
+            return m_chars[index_of(range)];
+        }
+
+        CERBLIB_DECL auto get_terminals() const -> const string_checker_t &
         {
-            return m_input.empty();
+            return m_context->checker;
+        }
+
+        constexpr auto shift(size_t offset) -> void
+        {
+            m_dot += offset;
+            move_pos(offset);
+        }
+
+        CERBLIB_DECL auto empty() const -> bool
+        {
+            return m_context->input.empty();
         }
 
         constexpr auto dump() const -> void
         {
-            m_global_position = m_current_pos;
+            m_context->global_position = m_current_pos;
+        }
+
+        // character of rule and number of its code units
+        CERBLIB_DECL auto rule_char(const string_view_t &rule, size_t index) const
+            -> Pair<u32, size_t>
+        {
+            if (m_utf8) {
+                return utf8::decode(rule.begin() + index, rule.end());
+            }
+
+            return { static_cast<u32>(to_unsigned(rule[index])), 1 };
         }
 
         template<typename T>
@@ -325,17 +486,38 @@ namespace cerb::lex {
         template<size_t Offset = 0>
         CERBLIB_DECL auto get_char() const -> CharT
         {
-            return m_input[m_dot + Offset];
+            return m_context->input[m_dot + Offset];
         }
 
         CERBLIB_DECL auto get_char(size_t offset) const -> CharT
         {
-            return m_input[m_dot + offset];
+            return m_context->input[m_dot + offset];
         }
 
-        CERBLIB_DECL static auto get_input() -> const string_view_t &
+        /**
+         * @brief character at the dot and number of its code units. UTF-8 input
+         * is decoded only after ASCII
+         */
+        CERBLIB_DECL auto get_code_point() const -> Pair<u32, size_t>
         {
-            return m_input;
+            u32 chr = to_unsigned(get_char());
+
+            if (chr >= 0x80 && m_utf8) [[unlikely]] {
+                const auto &input = m_context->input;
+                return utf8::decode(input.begin() + m_dot, input.end());
+            }
+
+            return { chr, 1 };
+        }
+
+        CERBLIB_DECL auto get_encoding() const -> Encoding
+        {
+            return m_utf8 ? Encoding::UTF8 : Encoding::BYTES;
+        }
+
+        CERBLIB_DECL auto get_input() const -> const string_view_t &
+        {
+            return m_context->input;
         }
 
         CERBLIB_DECL auto get_token_pos() const noexcept -> const position_t &
@@ -348,22 +530,22 @@ namespace cerb::lex {
             return m_token_begin;
         }
 
-        static constexpr auto add2input(size_t offset) -> void
+        constexpr auto add2input(size_t offset) const -> void
         {
-            auto &input = m_input;
-            m_input     = { cerb::min(input.begin() + offset, input.end()),
-                        input.end() };
+            auto &input = m_context->input;
+            input       = { cerb::min(input.begin() + offset, input.end()),
+                      input.end() };
         }
 
-        static constexpr auto add2input(string_view_iterator first) -> void
+        constexpr auto add2input(string_view_iterator first) const -> void
         {
-            auto &input = m_input;
-            m_input     = { cerb::min(first, input.end()), input.end() };
+            auto &input = m_context->input;
+            input       = { cerb::min(first, input.end()), input.end() };
         }
 
-        CERBLIB_DECL static auto get_line() -> string_view_t
+        CERBLIB_DECL auto get_line() const -> string_view_t
         {
-            const auto &line = m_current_line;
+            const auto &line = m_context->current_line;
             const auto pos   = line.contains('\n');
             return { line.begin(),
                      line.begin() + cmov(
@@ -373,32 +555,74 @@ namespace cerb::lex {
 
         CERBLIB_DECL auto isolate_token() const -> string_view_t
         {
-            size_t index         = m_dot;
-            string_view_t result = { m_input.begin() + index,
-                                     m_input.size() - index };
+            const auto &context  = *m_context;
+            size_t index         = 0;
+            string_view_t result = { context.input.begin() + m_dot,
+                                     context.input.size() - m_dot };
 
             CERBLIB_UNROLL_N(2)
-            while (!result.empty()) {
+            while (index < result.size()) {
                 CharT elem = result[index];
 
                 if (is_layout(elem) || elem == char_cast(0) ||
-                    check_substring(index, m_input, m_single_line_comment) ||
-                    check_substring(index, m_input, m_multiline_comment_begin) ||
-                    !m_checker.check(index, result).first.empty()) {
+                    context.begins_comment(index, result) ||
+                    !context.checker.check(index, result).first.empty()) {
                     break;
                 }
                 ++index;
             }
-            return { result.begin(), m_input.begin() + index };
+            return { result.begin(), index };
+        }
+
+        auto skip_span(const simd::Span &span) -> void
+        {
+            auto &context = *m_context;
+
+            if constexpr (!TrackPositions) {
+                add2input(span.length);
+                return;
+            }
+
+            if (span.newlines != 0) {
+                m_current_pos.line_number += span.newlines;
+                m_current_pos.char_number = 0;
+                context.current_line      = { context.input.begin() + span.line_begin,
+                                         context.input.end() };
+            }
+
+            m_current_pos += span.columns;
+            add2input(span.length);
+        }
+
+        auto skip_char() -> void
+        {
+            auto &context = *m_context;
+
+            if constexpr (!TrackPositions) {
+                add2input(1);
+                return;
+            }
+
+            if (get_char() == '\n') {
+                m_current_pos.new_line();
+                context.current_line = { context.input.begin() + 1,
+                                         context.input.end() };
+            } else {
+                m_current_pos += get_char() != '\r';
+            }
+            add2input(1);
         }
 
         auto skip_comments_and_layout() -> void
         {
+            using skipped_t   = typename ScanContext::Skipped;
+            auto &context     = *m_context;
             m_dot             = 0;
             SkipStatus status = EMPTY;
+            skipped_t comment{};
 
             CERBLIB_UNROLL_N(2)
-            while (!m_input.empty()) {
+            while (!context.input.empty()) {
                 // we will check for comments if there are allowed
                 if constexpr (AllowComments) {
                     /*
@@ -406,59 +630,74 @@ namespace cerb::lex {
                      * we need to check for comment beginning
                      * */
                     if (status == EMPTY) {
-                        if (check_substring(0, m_input, m_single_line_comment)) {
-                            status = SINGLE_LINE_COMMENT;
-                            add2input(m_single_line_comment.size());
-                            m_current_pos += m_single_line_comment.size();
-                            continue;
+                        if (context.may_begin_comment(get_char())) {
+                            comment = { context.input.begin(),
+                                        context.current_line.begin(), m_current_pos };
+
+                            if (check_substring(
+                                    0, context.input, context.single_line_comment)) {
+                                status = SINGLE_LINE_COMMENT;
+                                add2input(context.single_line_comment.size());
+                                move_pos(context.single_line_comment.size());
+                                continue;
+                            }
+                            if (check_substring(
+                                    0, context.input, context.multiline_comment_begin)) {
+                                status = MULTILINE_COMMENT;
+                                add2input(context.multiline_comment_begin.size());
+                                move_pos(context.multiline_comment_begin.size());
+                                continue;
+                            }
                         }
-                        if (check_substring(0, m_input, m_multiline_comment_begin)) {
-                            status = MULTILINE_COMMENT;
-                            add2input(m_multiline_comment_begin.size());
-                            m_current_pos += m_multiline_comment_begin.size();
-                            continue;
+                    } else if (status == SINGLE_LINE_COMMENT) {
+                        // new line is left for layout skipping, without it
+                        // comment may go on after the end of input
+                        skip_span(simd::skip_until<TrackPositions>(
+                            context.input.begin(), context.input.end(),
+                            char_cast('\n')));
+
+                        if (!context.input.empty()) {
+                            status = EMPTY;
                         }
-                    } else if (
-                        status == MULTILINE_COMMENT &&
-                        check_substring(0, m_input, m_multiline_comment_end)) {
-                        status = EMPTY;
-                        add2input(m_multiline_comment_begin.size());
-                        m_current_pos += m_multiline_comment_begin.size();
                         continue;
                     } else {
-                        if (get_char() == '\n') {
-                            m_current_pos.new_line();
-                            m_current_line = { m_input.begin() + 1, m_input.end() };
-                            status =
-                                cmov(status == SINGLE_LINE_COMMENT, EMPTY, status);
-                        } else {
-                            m_current_pos += get_char() != '\r';
+                        const auto &end = context.multiline_comment_end;
+                        skip_span(simd::skip_until<TrackPositions>(
+                            context.input.begin(), context.input.end(),
+                            end.empty() ? char_cast(0) : end[0]));
+
+                        if (check_substring(0, context.input, end)) {
+                            status = EMPTY;
+                            add2input(end.size());
+                            move_pos(end.size());
+                        } else if (!context.input.empty()) {
+                            skip_char();
                         }
-                        add2input(1);
                         continue;
                     }
                 }
                 if (is_layout(get_char())) {
-                    if (get_char() == '\n') {
-                        m_current_pos.new_line();
-                        m_current_line = { m_input.begin() + 1, m_input.end() };
-                        status = cmov(status == SINGLE_LINE_COMMENT, EMPTY, status);
-                    } else {
-                        m_current_pos += get_char() != '\r';
-                    }
-                    add2input(1);
+                    skip_span(simd::skip_layout<TrackPositions>(
+                        context.input.begin(), context.input.end()));
                     continue;
                 }
-                return;
+                break;
             }
+
+            if (status == EMPTY) {
+                comment = { context.input.begin(), context.current_line.begin(),
+                            m_current_pos };
+            }
+
+            context.skipped = comment;
         }
 
         constexpr auto
             set_input(const string_view_t &input, const string_view_t &filename)
                 -> void
         {
-            m_input        = input;
-            m_current_line = input;
+            m_context->input        = input;
+            m_context->current_line = input;
             skip_comments_and_layout();
             m_current_pos.filename = filename;
         }
@@ -467,7 +706,7 @@ namespace cerb::lex {
             -> void
         {
             m_dot           = 0;
-            m_token_begin   = m_input.begin();
+            m_token_begin   = m_context->input.begin();
             m_current_range = m_ranges.begin();
 
             if (reload_position) {
@@ -475,7 +714,7 @@ namespace cerb::lex {
                 m_current_pos.line_number = 0;
             }
             if (load_from_shared) {
-                m_current_pos = m_global_position;
+                m_current_pos = m_context->global_position;
             }
 
             m_token_pos = m_current_pos;
@@ -486,19 +725,116 @@ namespace cerb::lex {
             }
         }
 
-        static auto set_comments(
-            const string_view_t &single_line_comment,
-            const string_view_t &multiline_comment_begin,
-            const string_view_t &multiline_comment_end) -> void
+        /**
+         * @brief splits @p classes by ranges of the item
+         */
+        constexpr auto refine_classes(ByteClasses &classes) const -> void
         {
-            m_single_line_comment     = single_line_comment;
-            m_multiline_comment_begin = multiline_comment_begin;
-            m_multiline_comment_end   = multiline_comment_end;
+            CERBLIB_UNROLL_N(1)
+            for (const Range &range : m_ranges) {
+                const chars_t &chars = get_chars(range);
+                classes.refine([&chars](size_t byte) {
+                    return chars.contains(static_cast<u32>(byte));
+                });
+            }
         }
 
-        static auto set_terminals(const string_checker_t &checker) -> void
+        /**
+         * @brief binds item to the context, classes of context must be refined
+         * by all items before
+         */
+        constexpr auto bind(ScanContext &context) -> void
         {
-            m_checker = checker;
+            m_context = &context;
+
+            CERBLIB_UNROLL_N(1)
+            for (const Range &range : m_ranges) {
+                const chars_t &chars       = get_chars(range);
+                m_lookups[index_of(range)] = simd::make_lookup([&chars](size_t chr) {
+                    return chars.contains(static_cast<u32>(chr));
+                });
+            }
+
+            if (!context.classes.fits_mask()) {
+                return;
+            }
+
+            CERBLIB_UNROLL_N(1)
+            for (Range &range : m_ranges) {
+                const chars_t &chars = get_chars(range);
+                range.class_mask     = context.classes.mask([&chars](size_t byte) {
+                    return chars.contains(static_cast<u32>(byte));
+                });
+            }
+        }
+
+        /**
+         * @brief checks, that scan of token, which begins with @p chr, may
+         * finish on the item: word begins with @p chr, one of the leading
+         * ranges (up to the first mandatory one) contains it or terminal
+         * begins with it (items return terminals, which they can't continue)
+         */
+        CERBLIB_DECL auto may_begin_with(u32 chr) const -> bool
+        {
+            if (m_is_word) {
+                return m_word_repr.empty() || to_unsigned(m_word_repr[0]) == chr;
+            }
+
+            if (m_context->checker.check(char_cast(chr)).first) {
+                return true;
+            }
+
+            CERBLIB_UNROLL_N(1)
+            for (const Range &range : m_ranges) {
+                if (get_chars(range).contains(chr)) {
+                    return true;
+                }
+
+                if (range.rule == BASIC || range.rule == ONE_OR_MORE_TIMES) {
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief checks, that rule takes the whole @p word as check does it
+         * (ranges are greedy), so keyword may be found in the span of token.
+         * It does not need the context
+         */
+        CERBLIB_DECL auto takes_whole(const string_view_t &word) const -> bool
+        {
+            if (m_is_word) {
+                return m_word_repr == word;
+            }
+
+            size_t index = 0;
+
+            CERBLIB_UNROLL_N(1)
+            for (const Range &range : m_ranges) {
+                const chars_t &chars = get_chars(range);
+                bool repeated =
+                    range.rule == ONE_OR_MORE_TIMES || range.rule == ZERO_OR_MORE_TIMES;
+                size_t times = 0;
+
+                while (index != word.size() && (repeated || times == 0)) {
+                    auto [chr, length] = rule_char(word, index);
+
+                    if (!chars.contains(chr)) {
+                        break;
+                    }
+
+                    index += length;
+                    ++times;
+                }
+
+                if (times == 0 && (range.rule == BASIC || range.rule == ONE_OR_MORE_TIMES)) {
+                    return false;
+                }
+            }
+
+            return index != 0 && index == word.size();
         }
 
         CERBLIB_DECL auto can_end() const -> bool
@@ -532,7 +868,7 @@ namespace cerb::lex {
                     if (m_word_repr[m_dot] == get_char() &&
                         m_dot < m_word_repr.size()) {
                         ++m_dot;
-                        m_current_pos += 1;
+                        move_pos(1);
                         continue;
                     }
                     result_of_check = { { { m_token_begin, m_token_begin + m_dot },
@@ -543,17 +879,20 @@ namespace cerb::lex {
                         m_dot == m_word_repr.size(), SCAN_FINISHED, UNABLE_TO_MATCH);
                 }
 
-                ItemState state = m_current_range->check(get_char());
+                auto [chr, length] = get_code_point();
+                ItemState state    = m_current_range->check(
+                    chr, m_context->classes, get_chars(*m_current_range));
 
                 switch (state) {
                 case NEED_TO_SCAN:
-                    ++m_dot;
-                    m_current_pos += 1;
+                    m_dot += length;
+                    move_pos(length);
+                    scan_run();
                     break;
 
                 case NEED_TO_SWITCH_RANGE_AND_CHAR:
-                    ++m_dot;
-                    m_current_pos += 1;
+                    m_dot += length;
+                    move_pos(length);
                     [[fallthrough]];
 
                 case NEED_TO_SWITCH_RANGE:
@@ -571,8 +910,14 @@ namespace cerb::lex {
         }
 
     public:
-        constexpr explicit DotItem(const DotItemInitializer &item)
-          : priority(item.priority), m_is_word(item.word), m_token_type(item.type),
+        /**
+         * @brief item of @p item rule. Narrow rules and input are UTF-8 only if
+         * @p encoding says so, wider characters are never decoded
+         */
+        constexpr explicit DotItem(
+            const DotItemInitializer &item, Encoding encoding = Encoding::BYTES)
+          : priority(item.priority), m_token_type(item.type), m_is_word(item.word),
+            m_utf8(sizeof(CharT) == 1 && encoding == Encoding::UTF8),
             m_word_repr(item.rule)
         {
             if (item.word) {
@@ -580,18 +925,23 @@ namespace cerb::lex {
             }
 
             bool is_range = false;// if we are looking for a range of chars
-            bool are_brackets_opened = false;       // if range brackets are opened
-            auto letter              = char_cast(0);// previous letter
+            bool are_brackets_opened = false;          // if range brackets are opened
+            u32 letter               = 0;              // previous letter
             iterator current_range   = m_ranges.begin();// current range
 
-            for (const auto elem : item.rule) {
+            for (size_t index = 0; index < item.rule.size();) {
+                auto [elem, length] = rule_char(item.rule, index);
+                index += length;
+
+                throw_if_can(elem != utf8::Invalid, "Rule is not valid UTF-8!");
+
                 switch (elem) {
                 case '[':
                     throw_if_can(
                         !are_brackets_opened,
                         "You can't open range more than once!");
 
-                    letter              = char_cast(0);
+                    letter              = 0;
                     is_range            = false;
                     are_brackets_opened = true;
                     current_range       = m_ranges.last();
@@ -601,9 +951,9 @@ namespace cerb::lex {
                     throw_if_can(
                         are_brackets_opened, "There aren't any ranges to close");
 
-                    // set value to the bitmap, if it wasn't a range of elems
-                    if (letter != char_cast(0)) {
-                        current_range->template set<1>(letter);
+                    // add the letter, if it wasn't a range of elems
+                    if (letter != 0) {
+                        chars_of(current_range).add(letter, letter);
                     }
 
                     are_brackets_opened = false;
@@ -632,13 +982,10 @@ namespace cerb::lex {
                     break;
 
                 default:
-                    if (letter != char_cast(0) && is_range) {
-                        CERBLIB_UNROLL_N(4)
-                        for (; letter <= elem; ++letter) {
-                            current_range->template set<1>(letter);
-                        }
-                    } else if (letter != char_cast(0)) {
-                        current_range->template set<1>(letter);
+                    if (letter != 0 && is_range) {
+                        chars_of(current_range).add(letter, elem);
+                    } else if (letter != 0) {
+                        chars_of(current_range).add(letter, letter);
                     }
 
                     letter   = elem;
@@ -0,0 +1,375 @@
+#ifndef CERBERUS_LEX_DRIVER_HPP
+#define CERBERUS_LEX_DRIVER_HPP
+
+#include <span>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include <cerberus/vector.hpp>
+#include <cerberus/worker_pool.hpp>
+#include <cerberus/analyzation/lex/lex.hpp>
+#include <cerberus/analyzation/lex/mapped_source.hpp>
+#include <cerberus/analyzation/lex/token_buffer.hpp>
+
+namespace cerb::lex {
+    struct LexStatistics
+    {
+        size_t bytes{ 0 };
+        size_t tokens{ 0 };
+        std::chrono::duration<double> time{};
+
+        constexpr auto operator+=(const LexStatistics &other) -> LexStatistics &
+        {
+            bytes += other.bytes;
+            tokens += other.tokens;
+            time += other.time;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief lexer, which stores all tokens of one file. It owns the input (string
+     * or mapped file) and the name of file, so tokens stay valid as long as the
+     * collector is alive
+     * @tparam Lexer generated lexer (for example Lex4C<>)
+     */
+    template<typename Lexer>
+    class TokenCollector final : public Lexer
+    {
+    public:
+        using parent        = typename Lexer::parent;
+        using item_t        = typename parent::item_t;
+        using token_t       = typename parent::token_t;
+        using string_t      = typename parent::string_t;
+        using string_view_t = typename parent::string_view_t;
+        using CharT         = typename string_t::value_type;
+
+    private:
+        string_t m_filename{};
+        string_t m_input{};
+        MappedSource<CharT> m_source{};
+        string_view_t m_view{};
+        Vector<token_t> m_tokens{};
+        LexStatistics m_statistics{};
+
+    public:
+        CERBLIB_DECL auto tokens() const noexcept -> const Vector<token_t> &
+        {
+            return m_tokens;
+        }
+
+        CERBLIB_DECL auto statistics() const noexcept -> const LexStatistics &
+        {
+            return m_statistics;
+        }
+
+        CERBLIB_DECL auto filename() const noexcept -> const string_t &
+        {
+            return m_filename;
+        }
+
+        CERBLIB_DECL auto input() const noexcept -> const string_view_t &
+        {
+            return m_view;
+        }
+
+        auto run() -> void
+        {
+            std::array<token_t, parent::BATCH_SIZE> batch{};
+
+            auto begin = std::chrono::high_resolution_clock::now();
+            this->scan_batched(
+                m_view, { m_filename.data(), m_filename.size() }, batch);
+            auto end = std::chrono::high_resolution_clock::now();
+
+            m_statistics.bytes  = m_view.size();
+            m_statistics.tokens = m_tokens.size();
+            m_statistics.time   = end - begin;
+        }
+
+        constexpr auto yield(const token_t &token) -> bool override
+        {
+            m_tokens.push_back(token);
+            return true;
+        }
+
+        constexpr auto yield_batch(std::span<const token_t> tokens) -> bool override
+        {
+            CERBLIB_UNROLL_N(4)
+            for (const token_t &token : tokens) {
+                m_tokens.push_back(token);
+            }
+            return true;
+        }
+
+        // message is not printed here, because other workers may print too
+        constexpr auto error(const item_t &item, const string_view_t &repr)
+            -> void override
+        {
+            const auto &pos = item.get_token_pos();
+
+            throw analysis::lexical_analysis_error(fmt::format(
+                "Unable to find suitable dot item for: {} (file: {}, line: {}, "
+                "column: {})",
+                repr.to_string(), pos.filename.to_string(), pos.line_number + 1,
+                pos.char_number + 1));
+        }
+
+        constexpr auto finish() -> void override
+        {}
+
+        TokenCollector(string_t filename, string_t input)
+          : m_filename(std::move(filename)), m_input(std::move(input)),
+            m_view(m_input.data(), m_input.size())
+        {}
+
+        // tokens are views into the mapped file, it is not copied
+        TokenCollector(string_t filename, MappedSource<CharT> source)
+          : m_filename(std::move(filename)), m_source(std::move(source)),
+            m_view(m_source.view())
+        {}
+    };
+
+    /**
+     * @brief the same generated lexer, which does not count lines and columns.
+     * Other lexers are left as they are
+     */
+    template<typename Lexer>
+    struct WithoutPositions
+    {
+        using type = Lexer;
+    };
+
+    template<
+        template<typename, typename, bool, size_t, bool, bool, size_t, size_t, bool>
+        class Lexer,
+        typename CharT, typename TokenType, bool MayThrow, size_t UID,
+        bool AllowStringLiterals, bool AllowComments, size_t MaxTerminals,
+        size_t MaxSize4Terminals, bool TrackPositions>
+    struct WithoutPositions<Lexer<
+        CharT, TokenType, MayThrow, UID, AllowStringLiterals, AllowComments,
+        MaxTerminals, MaxSize4Terminals, TrackPositions>>
+    {
+        using type = Lexer<
+            CharT, TokenType, MayThrow, UID, AllowStringLiterals, AllowComments,
+            MaxTerminals, MaxSize4Terminals, false>;
+    };
+
+    /**
+     * @brief lexer, which stores only offsets, lengths and types of tokens in
+     * TokenBuffer. Lexer does not count lines and columns, positions are found
+     * by NewlineIndex, which is built on the first request
+     * @tparam Lexer generated lexer (for example Lex4C<>)
+     */
+    template<typename Lexer>
+    class OffsetTokenCollector final : public WithoutPositions<Lexer>::type
+    {
+    public:
+        using lexer_t       = typename WithoutPositions<Lexer>::type;
+        using parent        = typename lexer_t::parent;
+        using item_t        = typename parent::item_t;
+        using token_t       = typename parent::token_t;
+        using string_t      = typename parent::string_t;
+        using string_view_t = typename parent::string_view_t;
+        using CharT         = typename string_t::value_type;
+        using buffer_t      = TokenBuffer<CharT, decltype(token_t::type)>;
+
+    private:
+        string_t m_filename{};
+        string_t m_input{};
+        MappedSource<CharT> m_source{};
+        string_view_t m_view{};
+        buffer_t m_tokens{};
+        LexStatistics m_statistics{};
+
+    public:
+        CERBLIB_DECL auto tokens() const noexcept -> const buffer_t &
+        {
+            return m_tokens;
+        }
+
+        CERBLIB_DECL auto statistics() const noexcept -> const LexStatistics &
+        {
+            return m_statistics;
+        }
+
+        CERBLIB_DECL auto filename() const noexcept -> const string_t &
+        {
+            return m_filename;
+        }
+
+        CERBLIB_DECL auto input() const noexcept -> const string_view_t &
+        {
+            return m_view;
+        }
+
+        auto position(size_t index) const -> PositionInFile<CharT>
+        {
+            return m_tokens.position(index);
+        }
+
+        auto run() -> void
+        {
+            string_view_t filename{ m_filename.data(), m_filename.size() };
+
+            auto begin = std::chrono::high_resolution_clock::now();
+            u16 file   = m_tokens.add_file(filename, m_view);
+            this->set_input(m_view, filename);
+
+            CERBLIB_UNROLL_N(1)
+            for (const token_t *token = this->next_token(); token != nullptr;
+                 token                = this->next_token()) {
+                auto [first, last] = this->token_extent();
+                m_tokens.push_back(
+                    file, static_cast<size_t>(first - m_view.data()),
+                    static_cast<size_t>(last - first), token->type);
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+
+            m_statistics.bytes  = m_view.size();
+            m_statistics.tokens = m_tokens.size();
+            m_statistics.time   = end - begin;
+        }
+
+        // lexer does not count positions, so position of error is found here
+        auto error(const item_t & /*item*/, const string_view_t &repr)
+            -> void override
+        {
+            string_view_t filename{ m_filename.data(), m_filename.size() };
+            auto pos = NewlineIndex<CharT>(m_view, filename).position(repr.begin());
+
+            throw analysis::lexical_analysis_error(fmt::format(
+                "Unable to find suitable dot item for: {} (file: {}, line: {}, "
+                "column: {})",
+                repr.to_string(), pos.filename.to_string(), pos.line_number + 1,
+                pos.char_number + 1));
+        }
+
+        OffsetTokenCollector(string_t filename, string_t input)
+          : m_filename(std::move(filename)), m_input(std::move(input)),
+            m_view(m_input.data(), m_input.size())
+        {}
+
+        OffsetTokenCollector(string_t filename, MappedSource<CharT> source)
+          : m_filename(std::move(filename)), m_source(std::move(source)),
+            m_view(m_source.view())
+        {}
+    };
+
+    /**
+     * @brief lexes many files at once, every worker of the pool uses its own
+     * lexer, so files are processed independently
+     * @tparam Lexer generated lexer (for example Lex4C<>)
+     * @tparam Collector TokenCollector or OffsetTokenCollector
+     */
+    template<typename Lexer, template<typename> class Collector = TokenCollector>
+    class ParallelLexer
+    {
+    public:
+        using collector_t = Collector<Lexer>;
+        using string_t    = typename collector_t::string_t;
+
+        struct LexedFile
+        {
+            std::unique_ptr<collector_t> lexer{};
+            std::exception_ptr exception{};
+
+            CERBLIB_DECL auto succeeded() const noexcept -> bool
+            {
+                return exception == nullptr;
+            }
+        };
+
+        struct Result
+        {
+            std::vector<LexedFile> files{};
+            LexStatistics total{};
+            std::chrono::duration<double> wall_time{};
+        };
+
+    private:
+        WorkerPool m_pool;
+
+        // collector keeps the mapping alive and lexes the file from it
+        static auto read_file(const std::string &filename)
+            -> MappedSource<typename string_t::value_type>
+        {
+            return MappedSource<typename string_t::value_type>(filename);
+        }
+
+        template<typename F>
+        auto process(size_t count, F &&make_lexer) const -> Result
+        {
+            Result result{};
+            result.files.resize(count);
+
+            auto begin = std::chrono::high_resolution_clock::now();
+
+            m_pool.run(count, [&](size_t index) {
+                auto &file = result.files[index];
+
+                try {
+                    file.lexer = make_lexer(index);
+                    file.lexer->run();
+                } catch (...) {
+                    file.exception = std::current_exception();
+                }
+            });
+
+            auto end         = std::chrono::high_resolution_clock::now();
+            result.wall_time = end - begin;
+
+            CERBLIB_UNROLL_N(2)
+            for (const auto &file : result.files) {
+                if (file.lexer != nullptr) {
+                    result.total += file.lexer->statistics();
+                }
+            }
+
+            return result;
+        }
+
+    public:
+        CERBLIB_DECL auto workers() const noexcept -> size_t
+        {
+            return m_pool.size();
+        }
+
+        /**
+         * @brief reads and lexes files, reading is done by the workers too.
+         * Errors are stored in the result of the file, which caused them
+         */
+        auto lex_files(std::span<const std::string> filenames) const -> Result
+        {
+            return process(filenames.size(), [&](size_t index) {
+                const auto &filename = filenames[index];
+                return std::make_unique<collector_t>(
+                    string_t(filename.begin(), filename.end()),
+                    read_file(filename));
+            });
+        }
+
+        /**
+         * @brief lexes buffers, which have been already loaded. Every buffer is
+         * described by pair of filename and input
+         */
+        auto lex_buffers(std::span<const std::pair<string_t, string_t>> buffers) const
+            -> Result
+        {
+            return process(buffers.size(), [&](size_t index) {
+                const auto &[filename, input] = buffers[index];
+                return std::make_unique<collector_t>(filename, input);
+            });
+        }
+
+        explicit ParallelLexer(size_t workers = std::thread::hardware_concurrency())
+          : m_pool(workers)
+        {}
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_DRIVER_HPP */
@@ -0,0 +1,268 @@
+#ifndef CERBERUS_LEX_INCREMENTAL_HPP
+#define CERBERUS_LEX_INCREMENTAL_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cerberus/types.h>
+#include <cerberus/analyzation/lex/lex.hpp>
+
+namespace cerb::lex {
+    /**
+     * @brief keeps text and its tokens up to date after edits. Only tokens
+     * around the edit are scanned again: scanning starts from the token before
+     * the edit and stops as soon as the new token coincides with the old one
+     * after the edit, the rest of tokens is shifted. Tokens store offsets
+     * instead of pointers, so they do not depend on the buffer of text
+     * @tparam Lexer lexer with next_token (for example TokenCollector<Lex4C<>>)
+     */
+    template<typename Lexer>
+    class IncrementalLexer
+    {
+    public:
+        using parent        = typename Lexer::parent;
+        using token_t       = typename parent::token_t;
+        using string_t      = typename parent::string_t;
+        using string_view_t = typename parent::string_view_t;
+        using position_t    = typename parent::position_t;
+        using token_type_t  = decltype(token_t::type);
+        using CharT         = typename string_t::value_type;
+
+        struct Token
+        {
+            size_t offset{ 0 };
+            size_t length{ 0 };
+            token_type_t type{};
+            position_t pos{};
+            bool joined{ false };// found together with the previous token
+
+            CERBLIB_DECL auto end() const noexcept -> size_t
+            {
+                return offset + length;
+            }
+        };
+
+    private:
+        Lexer &m_lexer;
+        string_t m_filename{};
+        string_t m_text{};
+        std::vector<Token> m_tokens{};
+        size_t m_rescanned{ 0 };
+
+        CERBLIB_DECL auto offset_of(const CharT *pointer) const -> size_t
+        {
+            return static_cast<size_t>(pointer - m_text.data());
+        }
+
+        CERBLIB_DECL auto line_begin(size_t offset) const -> size_t
+        {
+            size_t newline = m_text.rfind('\n', offset == 0 ? 0 : offset - 1);
+            return newline == string_t::npos || newline >= offset ? 0 : newline + 1;
+        }
+
+        auto make_token(const token_t &token, bool joined) const -> Token
+        {
+            auto [begin, end] = m_lexer.token_extent();
+            return { offset_of(begin), static_cast<size_t>(end - begin), token.type,
+                     token.pos, joined };
+        }
+
+        /*
+         * scans text from m_tokens[first] (from the beginning, if it is the first
+         * token, because edit may be before it) and replaces
+         * old tokens until the new one coincides with the old one, which begins
+         * after the edit ([edit_begin, old_edit_end) in the old text)
+         */
+        auto rescan(size_t first, size_t edit_end, size_t old_edit_end, i64 delta)
+            -> void
+        {
+            position_t position{ 0, 0, { m_filename.data(), m_filename.size() } };
+            size_t offset = 0;
+
+            if (first != 0) {
+                offset   = m_tokens[first].offset;
+                position = m_tokens[first].pos;
+            }
+
+            size_t line = line_begin(offset);
+            m_lexer.clear_literals();
+            m_lexer.resume(
+                { m_text.data() + line, m_text.size() - line }, offset - line, position);
+
+            std::vector<Token> scanned{};
+            size_t old       = first;
+            bool synchronized = false;
+            Token current{};
+
+            CERBLIB_UNROLL_N(1)
+            while (true) {
+                bool joined          = m_lexer.has_pending();
+                const token_t *token = m_lexer.next_token();
+
+                if (token == nullptr) {
+                    old = m_tokens.size();
+                    break;
+                }
+
+                current = make_token(*token, joined);
+
+                if (!joined && current.offset >= edit_end) {
+                    CERBLIB_UNROLL_N(1)
+                    while (old < m_tokens.size() &&
+                           (m_tokens[old].offset < old_edit_end ||
+                            static_cast<i64>(m_tokens[old].offset) + delta <
+                                static_cast<i64>(current.offset))) {
+                        ++old;
+                    }
+
+                    if (old < m_tokens.size() && same(m_tokens[old], current, delta)) {
+                        synchronized = true;
+                        break;
+                    }
+                }
+
+                scanned.push_back(current);
+            }
+
+            if (synchronized) {
+                shift(old, current, delta);
+            }
+
+            m_rescanned = scanned.size();
+            m_tokens.erase(
+                m_tokens.begin() + static_cast<i64>(first),
+                m_tokens.begin() + static_cast<i64>(old));
+            m_tokens.insert(
+                m_tokens.begin() + static_cast<i64>(first), scanned.begin(),
+                scanned.end());
+        }
+
+        CERBLIB_DECL static auto same(const Token &old, const Token &current, i64 delta)
+            -> bool
+        {
+            return static_cast<i64>(old.offset) + delta ==
+                       static_cast<i64>(current.offset) &&
+                   old.length == current.length && old.type == current.type &&
+                   !old.joined;
+        }
+
+        /*
+         * tokens after the edit keep their place relatively to each other, columns
+         * change only on the line, where the synchronization has happened
+         */
+        auto shift(size_t from, const Token &current, i64 delta) -> void
+        {
+            const position_t &old_pos = m_tokens[from].pos;
+            size_t line               = old_pos.line_number;
+            auto line_delta           = static_cast<i64>(current.pos.line_number) -
+                              static_cast<i64>(line);
+            auto column_delta = static_cast<i64>(current.pos.char_number) -
+                                static_cast<i64>(old_pos.char_number);
+
+            CERBLIB_UNROLL_N(2)
+            for (auto it = m_tokens.begin() + static_cast<i64>(from);
+                 it != m_tokens.end(); ++it) {
+                if (it->pos.line_number == line) {
+                    it->pos.char_number = static_cast<size_t>(
+                        static_cast<i64>(it->pos.char_number) + column_delta);
+                }
+
+                it->pos.line_number = static_cast<size_t>(
+                    static_cast<i64>(it->pos.line_number) + line_delta);
+                it->offset = static_cast<size_t>(static_cast<i64>(it->offset) + delta);
+            }
+        }
+
+    public:
+        CERBLIB_DECL auto text() const noexcept -> const string_t &
+        {
+            return m_text;
+        }
+
+        CERBLIB_DECL auto tokens() const noexcept -> const std::vector<Token> &
+        {
+            return m_tokens;
+        }
+
+        /**
+         * @brief number of tokens, which have been scanned by the last update
+         */
+        CERBLIB_DECL auto rescanned() const noexcept -> size_t
+        {
+            return m_rescanned;
+        }
+
+        CERBLIB_DECL auto repr(const Token &token) const -> string_view_t
+        {
+            return { m_text.data() + token.offset, token.length };
+        }
+
+        /**
+         * @brief replaces the whole text and scans it
+         */
+        auto set_text(string_t text) -> void
+        {
+            m_text = std::move(text);
+            m_tokens.clear();
+
+            try {
+                rescan(0, 0, 0, 0);
+            } catch (...) {
+                m_tokens.clear();
+                throw;
+            }
+        }
+
+        /**
+         * @brief replaces @p removed characters at @p offset with @p inserted and
+         * updates tokens. If lexer throws, tokens are cleared and the next update
+         * scans the whole text
+         */
+        auto update(size_t offset, size_t removed, const string_view_t &inserted) -> void
+        {
+            m_text.replace(offset, removed, inserted.data(), inserted.size());
+
+            if (m_tokens.empty()) {
+                rescan(0, 0, 0, 0);
+                return;
+            }
+
+            // the token before the edit is scanned again, edit may continue it
+            auto affected = std::partition_point(
+                m_tokens.begin(), m_tokens.end(),
+                [offset](const Token &token) { return token.end() < offset; });
+            auto first = static_cast<size_t>(affected - m_tokens.begin());
+            first -= cmov(first != 0, 1UL, 0UL);
+
+            CERBLIB_UNROLL_N(1)
+            while (first != 0 && m_tokens[first].joined) {
+                --first;
+            }
+
+            try {
+                rescan(
+                    first, offset + inserted.size(), offset + removed,
+                    static_cast<i64>(inserted.size()) - static_cast<i64>(removed));
+            } catch (...) {
+                m_tokens.clear();
+                throw;
+            }
+        }
+
+        IncrementalLexer(Lexer &lexer, string_t filename)
+          : m_lexer(lexer), m_filename(std::move(filename))
+        {}
+
+        // positions of tokens point to the name of file
+        IncrementalLexer(const IncrementalLexer &) = delete;
+        IncrementalLexer(IncrementalLexer &&)      = delete;
+
+        auto operator=(const IncrementalLexer &) -> IncrementalLexer & = delete;
+        auto operator=(IncrementalLexer &&) -> IncrementalLexer &      = delete;
+
+        ~IncrementalLexer() = default;
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_INCREMENTAL_HPP */
@@ -0,0 +1,261 @@
+#ifndef CERBERUS_LEX_KEYWORD_SET_HPP
+#define CERBERUS_LEX_KEYWORD_SET_HPP
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <initializer_list>
+#include <cerberus/math.hpp>
+#include <cerberus/types.h>
+#include <cerberus/string_view.hpp>
+#include <cerberus/analyzation/lex/lex_string.hpp>
+
+namespace cerb::lex {
+    /**
+     * @brief keywords in perfect hash table (hash and displace). Span of token
+     * (identifier) is found with one hash and one comparison, so number of
+     * keywords does not affect the cost. Table may be built at compile time
+     */
+    template<typename CharT, typename TokenType, size_t MaxKeywords = 128>
+    class KeywordSet
+    {
+    public:
+        using string_view_t = basic_string_view<CharT>;
+
+        struct Keyword
+        {
+            string_view_t repr{};
+            TokenType type{};
+            u32 priority{};
+        };
+
+        constexpr static size_t Capacity  = MaxKeywords;
+        constexpr static size_t TableSize = std::bit_ceil(MaxKeywords * 2);
+
+        static_assert(MaxKeywords <= std::numeric_limits<u16>::max());
+
+    private:
+        std::array<Keyword, MaxKeywords> m_keywords{};
+        std::array<u16, TableSize> m_table{};// index of keyword + 1
+        std::array<u16, MaxKeywords> m_displacements{};
+        size_t m_size{ 0 };
+        size_t m_mask{ 0 };
+        size_t m_buckets_mask{ 0 };
+
+        CERBLIB_DECL static auto hash(const string_view_t &word) -> u64
+        {
+            u64 result = 0xCBF2'9CE4'8422'2325ULL ^ word.size();
+
+            CERBLIB_UNROLL_N(4)
+            for (CharT chr : word) {
+                result = (result ^ to_unsigned(chr)) * 0x100'0000'01B3ULL;
+            }
+
+            return result;
+        }
+
+        CERBLIB_DECL static auto mix(u64 value) -> u64
+        {
+            value ^= value >> 33U;
+            value *= 0xFF51'AFD7'ED55'8CCDULL;
+            value ^= value >> 33U;
+            return value;
+        }
+
+        CERBLIB_DECL auto bucket(u64 hash_value) const -> size_t
+        {
+            return static_cast<size_t>(mix(hash_value) >> 40U) & m_buckets_mask;
+        }
+
+        CERBLIB_DECL auto slot(u64 hash_value, u16 displacement) const -> size_t
+        {
+            return static_cast<size_t>(
+                       mix(hash_value + displacement * 0x9E37'79B9'7F4A'7C15ULL)) &
+                   m_mask;
+        }
+
+        /*
+         * keys of every bucket get their own displacement, large buckets are
+         * placed first, while the table is empty
+         */
+        constexpr auto place_buckets() -> void
+        {
+            std::array<u64, MaxKeywords> hashes{};
+            std::array<bool, MaxKeywords> skipped{};
+            std::array<size_t, MaxKeywords> sizes{};
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != m_size; ++i) {
+                hashes[i] = hash(m_keywords[i].repr);
+
+                // the first of equal keywords wins
+                CERBLIB_UNROLL_N(1)
+                for (size_t j = 0; j != i; ++j) {
+                    skipped[i] = skipped[i] || m_keywords[i].repr == m_keywords[j].repr;
+                }
+
+                sizes[bucket(hashes[i])] += skipped[i] ? 0U : 1U;
+            }
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t size = m_size; size != 0; --size) {
+                CERBLIB_UNROLL_N(1)
+                for (size_t i = 0; i <= m_buckets_mask; ++i) {
+                    if (sizes[i] == size) {
+                        place_bucket(i, hashes, skipped);
+                    }
+                }
+            }
+        }
+
+        constexpr auto place_bucket(
+            size_t bucket_index, const std::array<u64, MaxKeywords> &hashes,
+            const std::array<bool, MaxKeywords> &skipped) -> void
+        {
+            for (u16 displacement = 0;
+                 displacement != std::numeric_limits<u16>::max(); ++displacement) {
+                if (try_place(bucket_index, displacement, hashes, skipped)) {
+                    m_displacements[bucket_index] = displacement;
+                    return;
+                }
+            }
+
+            throw std::logic_error("Unable to build perfect hash for keywords!");
+        }
+
+        constexpr auto try_place(
+            size_t bucket_index, u16 displacement,
+            const std::array<u64, MaxKeywords> &hashes,
+            const std::array<bool, MaxKeywords> &skipped) -> bool
+        {
+            std::array<size_t, MaxKeywords> slots{};
+            size_t count = 0;
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != m_size; ++i) {
+                if (skipped[i] || bucket(hashes[i]) != bucket_index) {
+                    continue;
+                }
+
+                size_t index = slot(hashes[i], displacement);
+
+                if (m_table[index] != 0) {
+                    CERBLIB_UNROLL_N(1)
+                    for (size_t j = 0; j != count; ++j) {
+                        m_table[slots[j]] = 0;
+                    }
+                    return false;
+                }
+
+                m_table[index]  = static_cast<u16>(i + 1);
+                slots[count++] = index;
+            }
+
+            return true;
+        }
+
+    public:
+        /**
+         * @brief checks, that @p repr can be found by find
+         */
+        CERBLIB_DECL static auto can_hold(const string_view_t &repr) -> bool
+        {
+            return !repr.empty();
+        }
+
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_size;
+        }
+
+        CERBLIB_DECL auto empty() const noexcept -> bool
+        {
+            return m_size == 0;
+        }
+
+        /**
+         * @brief keywords sorted by priority and type
+         */
+        CERBLIB_DECL auto begin() const noexcept -> const Keyword *
+        {
+            return m_keywords.data();
+        }
+
+        CERBLIB_DECL auto end() const noexcept -> const Keyword *
+        {
+            return m_keywords.data() + m_size;
+        }
+
+        /**
+         * @brief finds keyword, which is equal to @p word (for example, span of
+         * identifier), so "format" is not "for"
+         */
+        CERBLIB_DECL auto find(const string_view_t &word) const -> const Keyword *
+        {
+            if (m_size == 0) {
+                return nullptr;
+            }
+
+            u64 hash_value = hash(word);
+            u16 index = m_table[slot(hash_value, m_displacements[bucket(hash_value)])];
+
+            if (index == 0 || m_keywords[index - 1].repr != word) {
+                return nullptr;
+            }
+
+            return &m_keywords[index - 1];
+        }
+
+        /**
+         * @brief adds keyword, table is built by build. Returns false, if
+         * keyword can't be added
+         */
+        constexpr auto insert(const Keyword &keyword) -> bool
+        {
+            if (m_size == MaxKeywords || !can_hold(keyword.repr)) {
+                return false;
+            }
+
+            size_t i = m_size++;
+
+            for (; i != 0 && (keyword.priority < m_keywords[i - 1].priority ||
+                              (keyword.priority == m_keywords[i - 1].priority &&
+                               keyword.type < m_keywords[i - 1].type));
+                 --i) {
+                m_keywords[i] = m_keywords[i - 1];
+            }
+
+            m_keywords[i] = keyword;
+            return true;
+        }
+
+        /**
+         * @brief builds the table, it must be called after insertions
+         */
+        constexpr auto build() -> void
+        {
+            m_table         = {};
+            m_displacements = {};
+            m_mask          = std::bit_ceil(cerb::max<size_t>(m_size * 2, 1UL)) - 1;
+            m_buckets_mask  = std::bit_ceil(cerb::max<size_t>(m_size / 2, 1UL)) - 1;
+            place_buckets();
+        }
+
+        constexpr KeywordSet() = default;
+
+        constexpr KeywordSet(const std::initializer_list<Keyword> &keywords)
+        {
+            CERBLIB_UNROLL_N(2)
+            for (const Keyword &keyword : keywords) {
+                if (!insert(keyword)) {
+                    throw std::out_of_range("Keyword set can't hold the keyword!");
+                }
+            }
+
+            build();
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_KEYWORD_SET_HPP */
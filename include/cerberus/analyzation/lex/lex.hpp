@@ -1,9 +1,17 @@
 #ifndef CERBERUS_LEX_HPP
 #define CERBERUS_LEX_HPP
 
+#include <span>
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <cerberus/bump_arena.hpp>
 #include <cerberus/analyzation/exceptions.hpp>
+#include <cerberus/analyzation/lex/dfa.hpp>
 #include <cerberus/analyzation/lex/dot_item.hpp>
-#include <cerberus/deque.hpp>
+#include <cerberus/analyzation/lex/keyword_set.hpp>
 
 #define CERBERUS_LEX_PARENT_CLASS                                                   \
     cerb::lex::LexicalAnalyzer<                                                     \
@@ -14,7 +22,8 @@
         AllowStringLiterals,                                                        \
         AllowComments,                                                              \
         MaxTerminals,                                                               \
-        MaxSize4Terminals>
+        MaxSize4Terminals,                                                          \
+        TrackPositions>
 
 #define CERBERUS_LEX_PARENT_CLASS_ACCESS                                            \
     using parent = cerb::lex::LexicalAnalyzer<                                      \
@@ -25,7 +34,38 @@
         AllowStringLiterals,                                                        \
         AllowComments,                                                              \
         MaxTerminals,                                                               \
-        MaxSize4Terminals>;                                                         \
+        MaxSize4Terminals,                                                          \
+        TrackPositions>;                                                            \
+    CERBERUS_LEX_PARENT_TYPES
+
+#define CERBERUS_STATIC_LEX_PARENT_CLASS                                            \
+    cerb::lex::StaticLexicalAnalyzer<                                               \
+        Derived,                                                                    \
+        CharT,                                                                      \
+        TokenType,                                                                  \
+        MayThrow,                                                                   \
+        UID,                                                                        \
+        AllowStringLiterals,                                                        \
+        AllowComments,                                                              \
+        MaxTerminals,                                                               \
+        MaxSize4Terminals,                                                          \
+        TrackPositions>
+
+#define CERBERUS_STATIC_LEX_PARENT_CLASS_ACCESS                                     \
+    using parent = cerb::lex::StaticLexicalAnalyzer<                                \
+        Derived,                                                                    \
+        CharT,                                                                      \
+        TokenType,                                                                  \
+        MayThrow,                                                                   \
+        UID,                                                                        \
+        AllowStringLiterals,                                                        \
+        AllowComments,                                                              \
+        MaxTerminals,                                                               \
+        MaxSize4Terminals,                                                          \
+        TrackPositions>;                                                            \
+    CERBERUS_LEX_PARENT_TYPES
+
+#define CERBERUS_LEX_PARENT_TYPES                                                   \
     using parent::m_items;                                                          \
     using parent::head;                                                             \
     using item_t             = typename parent::item_t;                             \
@@ -37,10 +77,31 @@
     using string_view_t      = typename parent::string_view_t;                      \
     using string_checker_t   = typename parent::string_checker_t;                   \
     using item_initializer   = typename parent::item_initializer;                   \
+    using keyword_set_t      = typename parent::keyword_set_t;                      \
     using string_container_t = typename parent::string_container_t;
 
 namespace cerb::lex {
+    enum LexicalErrorCode : u8
+    {
+        UNKNOWN_TOKEN,
+        INVALID_CHAR_LITERAL
+    };
+
+    constexpr gl::Map<LexicalErrorCode, cerb::string_view, 2> LexicalErrorRepr{
+        { UNKNOWN_TOKEN, "Unable to find suitable dot item" },
+        { INVALID_CHAR_LITERAL, "Char can contain only one elem" }
+    };
+
+    /**
+     * @brief lexical analyzer, which calls yield, finish, error and
+     * process_string of Derived without virtual calls (CRTP). yield, finish and
+     * process_string have default implementations, error must be provided.
+     * Without TrackPositions lines and columns are not counted, positions of
+     * tokens keep only the name of file (offsets of tokens are enough to find
+     * them with NewlineIndex)
+     */
     template<
+        typename Derived,
         typename CharT,
         typename TokenType,
         bool MayThrow            = true,
@@ -48,8 +109,9 @@ namespace cerb::lex {
         bool AllowStringLiterals = true,
         bool AllowComments       = true,
         size_t MaxTerminals      = 128,
-        size_t MaxSize4Terminals = 4>
-    struct LexicalAnalyzer
+        size_t MaxSize4Terminals = 4,
+        bool TrackPositions      = true>
+    struct StaticLexicalAnalyzer
     {
         template<typename T>
         static constexpr auto char_cast(T chr) noexcept -> CharT
@@ -65,18 +127,48 @@ namespace cerb::lex {
             AllowStringLiterals,
             AllowComments,
             MaxTerminals,
-            MaxSize4Terminals>;
+            MaxSize4Terminals,
+            TrackPositions>;
 
-        using storage_t          = Set<item_t, MayThrow, less<void>>;
+        using storage_t          = std::vector<item_t>;// sorted by priority
         using token_t            = typename item_t::token_t;
         using result_t           = typename item_t::result_t;
         using position_t         = typename item_t::position_t;
         using string_view_t      = typename item_t::string_view_t;
         using string_checker_t   = typename item_t::string_checker_t;
         using item_initializer   = typename item_t::DotItemInitializer;
-        using storage_iterator   = typename storage_t::iterator;
+        using storage_iterator   = item_t *;
         using string_t           = std::basic_string<CharT>;
-        using string_container_t = Deque<string_t, 8, MayThrow>;
+        using string_container_t = BumpArena<CharT>;
+        using context_t          = typename item_t::ScanContext;
+        using dfa_t              = Dfa<TokenType>;
+        using dfa_tables_t       = DfaTables<TokenType>;
+        using keyword_set_t      = KeywordSet<CharT, TokenType>;
+        using candidates_t       = std::span<item_t *const>;
+        using iterator_t         = typename string_view_t::iterator;
+
+        /**
+         * @brief state of the lexer after the taken tokens: the first not consumed
+         * character, beginning of its line and its position
+         */
+        struct Checkpoint
+        {
+            iterator_t input{};
+            iterator_t line{};
+            position_t position{};
+        };
+
+        /**
+         * @brief error, which has been skipped in recovery mode. Offset is counted
+         * from the beginning of input, which has been given to set_input or resume
+         */
+        struct Diagnostic
+        {
+            size_t offset{ 0 };
+            size_t length{ 0 };
+            LexicalErrorCode reason{};
+            position_t pos{};
+        };
 
         enum PriorityLevel
         {
@@ -85,24 +177,41 @@ namespace cerb::lex {
             HIGH   = 0
         };
 
+        // row of candidates for the characters, which are not dispatched
+        static constexpr size_t OTHER_CHARS = 256UL;
+        // multibyte UTF-8 characters are decoded only after the first byte
+        static constexpr size_t DISPATCHED_CHARS = sizeof(CharT) == 1 ? 0x80UL : 256UL;
+
+        context_t m_context{};
         storage_t m_items{};
+        keyword_set_t m_keywords{};
         string_container_t m_strings{};
+        string_t m_literal{};
         storage_iterator m_head{ nullptr };
+        std::vector<item_t *> m_candidates{};// items in priority order for each row
+        std::array<size_t, OTHER_CHARS + 2> m_candidates_offsets{};
+        dfa_tables_t m_dfa_tables{};
+        dfa_t m_dfa{};
+        std::vector<Diagnostic> m_diagnostics{};
+        iterator_t m_input_begin{};
+        std::array<token_t, 2> m_pending{};
+        size_t m_pending_begin{ 0 };
+        size_t m_pending_end{ 0 };
+        item_t *m_advance_item{ nullptr };
+        size_t m_advance_shift{ 0 };
+        size_t m_advance_skip{ 0 };
+        bool m_finished{ true };
+        bool m_recover_errors{ false };
         const TokenType m_string_type{};
         const TokenType m_char_type{};
         const CharT m_string_separator{};
         const CharT m_char_separator{};
+        const Encoding m_encoding{};
         static constexpr size_t RESERVED        = 16UL;
+        static constexpr size_t BATCH_SIZE      = 256UL;
         static constexpr string_view_t repr4EoF = "$";
 
     private:
-        enum StringScanState
-        {
-            CONTINUE,
-            FINISH,
-            NONE
-        };
-
         static constexpr gl::Map<CharT, u8, 22, MayThrow> hex_chars{
             { char_cast('0'), 0 },  { char_cast('1'), 1 },  { char_cast('2'), 2 },
             { char_cast('3'), 3 },  { char_cast('4'), 4 },  { char_cast('5'), 5 },
@@ -253,12 +362,137 @@ namespace cerb::lex {
             }
         }
 
-        CERBLIB_DECL auto evaluate_string() -> bool
+        constexpr auto push_pending(const token_t &token) -> void
+        {
+            m_pending[m_pending_end++] = token;
+        }
+
+        /*
+         * input is moved over the found tokens only when all of them have been
+         * taken, so the input stays on the token, which has been rejected by yield
+         */
+        constexpr auto defer_advance(item_t &item, size_t shift, size_t skip) -> void
+        {
+            m_advance_item  = &item;
+            m_advance_shift = shift;
+            m_advance_skip  = skip;
+        }
+
+        constexpr auto advance() -> void
         {
-            m_strings.emplace_back();
-            auto &str   = m_strings.back();
-            auto result = process_string(*head(), str);
-            token_t token{ { str.data(), str.size() },
+            if (m_advance_item == nullptr) {
+                return;
+            }
+
+            item_t &item = *std::exchange(m_advance_item, nullptr);
+            item.shift(m_advance_shift);
+            item.add2input(m_advance_skip);
+            item.skip_comments_and_layout();
+            item.dump();
+        }
+
+        constexpr auto
+            add_diagnostic(LexicalErrorCode reason, iterator_t first, size_t length)
+                -> void
+        {
+            m_diagnostics.push_back({ static_cast<size_t>(first - m_input_begin),
+                                      length, reason, head()->get_token_pos() });
+        }
+
+        /*
+         * characters, which can't begin any token, are skipped until layout,
+         * comment or terminal, as error() shows them (at least one character)
+         */
+        auto skip_unknown_token() -> void
+        {
+            head()->rebind();
+
+            size_t length = cerb::max(
+                head()->isolate_token().size(), head()->get_code_point().second);
+
+            add_diagnostic(UNKNOWN_TOKEN, head()->get_begin_of_token(), length);
+            head()->shift(length);
+            head()->add2input(length);
+            head()->skip_comments_and_layout();
+            head()->dump();
+        }
+
+        /*
+         * index of the first separator, backslash or '\0' in literal at @p index
+         * or after it, plain characters are skipped in blocks
+         */
+        CERBLIB_DECL static auto
+            find_literal_stop(const item_t &item, CharT separator, size_t index)
+                -> size_t
+        {
+            const auto &input = item.get_input();
+            size_t offset     = item.dot() + index;
+
+            if (offset < input.size()) {
+                index += simd::count_until(
+                    input.begin() + offset, input.end(), separator, char_cast('\\'),
+                    char_cast('\0'));
+            }
+
+            auto is_stop = [separator](CharT chr) {
+                return chr == separator || chr == char_cast('\\') ||
+                       chr == char_cast('\0');
+            };
+
+            while (!is_stop(item.get_char(index))) {
+                ++index;
+            }
+
+            return index;
+        }
+
+        /*
+         * returns index of the closing separator, if literal does not have any
+         * escape sequences, otherwise 0
+         */
+        CERBLIB_DECL auto find_plain_literal(CharT separator, size_t index) const
+            -> size_t
+        {
+            index = find_literal_stop(*head(), separator, index);
+            return head()->get_char(index) == separator ? index : 0;
+        }
+
+        // returns index of the first character after plain ones
+        constexpr auto
+            copy_plain_chars(const item_t &item, size_t index, string_t &result) const
+            -> size_t
+        {
+            size_t stop = find_literal_stop(item, m_string_separator, index);
+            const auto *plain = item.get_input().begin() + item.dot() + index;
+
+            result.append(plain, stop - index);
+            return stop;
+        }
+
+        constexpr auto store_literal(const string_t &literal) -> string_view_t
+        {
+            return { m_strings.store(literal.data(), literal.size()), literal.size() };
+        }
+
+        /*
+         * literals without escape sequences are taken straight from the input,
+         * other ones are unescaped into the arena
+         */
+        constexpr auto evaluate_string() -> void
+        {
+            string_view_t str{};
+            size_t result = find_plain_literal(m_string_separator, 1);
+
+            if (result != 0) {
+                str = { head()->get_input().begin() + 1, result - 1 };
+                ++result;
+            } else {
+                m_literal.clear();
+                result = derived().process_string(*head(), m_literal);
+                str    = store_literal(m_literal);
+            }
+
+            token_t token{ str,
                            cmov(
                                m_char_separator == m_string_separator &&
                                    str.size() == 1,
@@ -267,59 +501,287 @@ namespace cerb::lex {
                            head()->get_begin_of_token(),
                            head()->get_token_pos() };
 
-            if (!yield(token)) {
-                finish();
-                return false;
-            }
-
-            head()->add2input(result);
-            head()->skip_comments_and_layout();
-            head()->dump();
-            return true;
+            push_pending(token);
+            defer_advance(*head(), 0, result);
         }
 
-        CERBLIB_DECL auto evaluate_char() -> bool
+        constexpr auto evaluate_char() -> void
         {
-            m_strings.emplace_back();
-            auto result =
-                process_char(m_char_separator, 1, *head(), m_strings.back());
+            string_view_t str{};
+            size_t index = 2;
+
+            if (head()->get_char(1) == char_cast('\\')) {
+                m_literal.clear();
+                index = process_char(m_char_separator, 1, *head(), m_literal).second;
+                str   = store_literal(m_literal);
+            } else if (head()->get_char(1) != m_char_separator) {
+                str = { head()->get_input().begin() + 1, 1 };
+            }
 
-            auto &str = m_strings.back();
-            token_t token{ { str.data(), str.size() },
+            token_t token{ str,
                            m_char_type,
                            head()->get_begin_of_token(),
                            head()->get_token_pos() };
 
-            throw_if_can(
-                head()->get_char(result.second) == m_char_separator,
-                token,
-                "Char can contain only one elem");
+            // in recovery mode the rest of literal is skipped until its line ends
+            if (head()->get_char(index) != m_char_separator && m_recover_errors) {
+                for (CharT chr = head()->get_char(index);
+                     chr != m_char_separator && chr != char_cast('\n') &&
+                     chr != char_cast('\0');
+                     chr = head()->get_char(++index)) {}
 
-            if (!yield(token)) {
-                finish();
-                return false;
+                index += cmov(head()->get_char(index) == m_char_separator, 1UL, 0UL);
+                add_diagnostic(INVALID_CHAR_LITERAL, token.location, index);
+                push_pending(token);
+                defer_advance(*head(), 0, index);
+                return;
             }
 
-            head()->add2input(result.second + 1);
-            head()->skip_comments_and_layout();
-            head()->dump();
+            throw_if_can(
+                head()->get_char(index) == m_char_separator,
+                token,
+                "Char can contain only one elem");
 
-            return true;
+            push_pending(token);
+            defer_advance(*head(), 0, index + 1);
         }
 
-        CERBLIB_DECL auto manage_char_and_string() -> StringScanState
+        CERBLIB_DECL auto manage_char_and_string() -> bool
         {
             if constexpr (AllowStringLiterals) {
                 if (m_string_separator != item_t::char_cast(0) &&
                     head()->get_char() == m_string_separator) {
-                    return cmov(evaluate_string(), CONTINUE, FINISH);
+                    evaluate_string();
+                    return true;
                 }
                 if (m_char_separator != item_t::char_cast(0) &&
                     head()->get_char() == m_char_separator) {
-                    return cmov(evaluate_char(), CONTINUE, FINISH);
+                    evaluate_char();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /*
+         * items are stored contiguously in priority order (the first of equal
+         * items wins), they are never moved after that, because lexer keeps
+         * pointers to them
+         */
+        constexpr auto emplace_items(std::vector<const item_initializer *> order)
+            -> void
+        {
+            constexpr auto less = [](const item_initializer *lhs,
+                                     const item_initializer *rhs) {
+                return lhs->priority < rhs->priority ||
+                       (lhs->priority == rhs->priority && lhs->type < rhs->type);
+            };
+
+            std::stable_sort(order.begin(), order.end(), less);
+            order.erase(
+                std::unique(
+                    order.begin(), order.end(),
+                    [less](const item_initializer *lhs, const item_initializer *rhs) {
+                        return !less(lhs, rhs);
+                    }),
+                order.end());
+
+            m_items.reserve(cerb::max<size_t>(order.size(), 1UL));
+
+            CERBLIB_UNROLL_N(2)
+            for (const item_initializer *rule : order) {
+                m_items.emplace_back(*rule, m_encoding);
+            }
+
+            // the first item keeps the input and position
+            if (m_items.empty()) {
+                m_items.emplace_back(item_initializer{}, m_encoding);
+            }
+        }
+
+        constexpr auto bind_items(
+            const string_view_t &single_line_comment,
+            const string_view_t &multiline_comment_begin,
+            const string_view_t &multiline_comment_end) -> void
+        {
+            m_context.set_comments(
+                single_line_comment, multiline_comment_begin, multiline_comment_end);
+            m_context.classes = {};
+
+            CERBLIB_UNROLL_N(2)
+            for (const item_t &elem : m_items) {
+                elem.refine_classes(m_context.classes);
+            }
+
+            CERBLIB_UNROLL_N(2)
+            for (item_t &elem : m_items) {
+                elem.bind(m_context);
+            }
+
+            build_candidates();
+        }
+
+        /*
+         * for every first character items, which may match token beginning with
+         * it, are stored in priority order, so others are not rebound and checked
+         */
+        constexpr auto build_candidates() -> void
+        {
+            m_candidates.clear();
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t chr = 0; chr != OTHER_CHARS; ++chr) {
+                m_candidates_offsets[chr] = m_candidates.size();
+
+                if (chr >= DISPATCHED_CHARS) {
+                    continue;
                 }
+
+                CERBLIB_UNROLL_N(2)
+                for (item_t &elem : m_items) {
+                    if (elem.may_begin_with(static_cast<u32>(chr))) {
+                        m_candidates.push_back(&elem);
+                    }
+                }
+            }
+
+            m_candidates_offsets[OTHER_CHARS] = m_candidates.size();
+
+            CERBLIB_UNROLL_N(2)
+            for (item_t &elem : m_items) {
+                m_candidates.push_back(&elem);
             }
-            return NONE;
+
+            m_candidates_offsets[OTHER_CHARS + 1] = m_candidates.size();
+        }
+
+        CERBLIB_DECL auto candidates(CharT chr) const -> candidates_t
+        {
+            size_t row = to_unsigned(chr);
+            row        = row < DISPATCHED_CHARS ? row : OTHER_CHARS;
+
+            return { m_candidates.data() + m_candidates_offsets[row],
+                     m_candidates.data() + m_candidates_offsets[row + 1] };
+        }
+
+        /*
+         * token, which is equal to keyword, becomes keyword, if the keyword goes
+         * before the item, which has found it, in priority order
+         */
+        CERBLIB_DECL auto keyword_type(const item_t &item, const token_t &token) const
+            -> TokenType
+        {
+            if (m_keywords.empty() || token.type != item.get_type()) {
+                return token.type;
+            }
+
+            const auto *keyword = m_keywords.find(token.repr);
+
+            if (keyword == nullptr || keyword->priority > item.priority ||
+                (keyword->priority == item.priority && keyword->type > token.type)) {
+                return token.type;
+            }
+
+            return keyword->type;
+        }
+
+        /*
+         * words, which are taken whole by other rules (identifiers), become
+         * keywords and they are found in spans of those rules, so word ends where
+         * identifier ends. Other words remain items
+         */
+        constexpr auto add_keyword(
+            const std::vector<item_t> &spans, const item_initializer &rule) -> bool
+        {
+            return rule.word &&
+                   std::any_of(
+                       spans.begin(), spans.end(),
+                       [&rule](const item_t &item) {
+                           return item.takes_whole(rule.rule);
+                       }) &&
+                   m_keywords.insert({ rule.rule, rule.type, rule.priority });
+        }
+
+        CERBLIB_DECL auto match_with_items() -> bool
+        {
+            item_t *item = nullptr;
+
+            CERBLIB_UNROLL_N(2)
+            for (item_t *elem : candidates(head()->get_char())) {
+                elem->rebind();
+
+                if (elem->check() == SCAN_FINISHED) {
+                    item = elem;
+                    break;
+                }
+            }
+
+            if (item == nullptr) {
+                return false;
+            }
+
+            CERBLIB_UNROLL_N(1)
+            for (token_t result : item->result()) {
+                result.type = keyword_type(*item, result);
+                push_pending(result);
+            }
+
+            defer_advance(*item, 0, item->dot());
+            return true;
+        }
+
+        /*
+         * DotItem may stop before its mandatory ranges, only if token is followed
+         * by layout, comment or end of input
+         */
+        CERBLIB_DECL auto ends_before_layout(size_t index) const -> bool
+        {
+            const auto &input = head()->get_input();
+
+            if (index == input.size() || is_layout_or_end_of_input(input[index])) {
+                return true;
+            }
+
+            if constexpr (AllowComments) {
+                return m_context.begins_comment(index, input);
+            }
+
+            return false;
+        }
+
+        /*
+         * the same check, as DotItem does after its token: token must be followed
+         * by layout, comment, terminal or end of input
+         */
+        CERBLIB_DECL auto ends_token(size_t index) const -> bool
+        {
+            return ends_before_layout(index) ||
+                   m_dfa.begins_terminal(head()->get_input(), index);
+        }
+
+        CERBLIB_DECL auto match_with_dfa() -> bool
+        {
+            auto match = m_dfa.match(head()->get_input());
+            auto type  = match.type;
+
+            if (match.length == 0) {
+                return false;
+            }
+
+            if (match.partial && ends_before_layout(match.length)) {
+                type = match.partial_type;
+            } else if (!match.full || (match.bounded && !ends_token(match.length))) {
+                return false;
+            }
+
+            token_t token{ { head()->get_begin_of_token(), match.length },
+                           type,
+                           head()->get_begin_of_token(),
+                           head()->get_token_pos() };
+
+            push_pending(token);
+            defer_advance(*head(), match.length, match.length);
+            return true;
         }
 
     public:
@@ -328,133 +790,602 @@ namespace cerb::lex {
             return m_head;
         }
 
-        virtual void finish()                                             = 0;
-        virtual bool yield(const token_t &token)                          = 0;
-        virtual void error(const item_t &item, const string_view_t &repr) = 0;
+        CERBLIB_DECL auto derived() noexcept -> Derived &
+        {
+            return static_cast<Derived &>(*this);
+        }
 
-        CERBLIB_DECL virtual auto process_string(item_t &item, string_t &result)
-            -> size_t
+        // lexers, which take tokens with next_token, do not need yield and finish
+        constexpr auto finish() -> void
+        {}
+
+        constexpr auto yield(const token_t & /*token*/) -> bool
+        {
+            return true;
+        }
+
+        // lexers, which do not take tokens in batches, get them one by one
+        constexpr auto yield_batch(std::span<const token_t> tokens) -> bool
+        {
+            CERBLIB_UNROLL_N(2)
+            for (const token_t &token : tokens) {
+                if (!derived().yield(token)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // it is called only for string literals with escape sequences
+        CERBLIB_DECL auto process_string(item_t &item, string_t &result) -> size_t
         {
             throw_if_can(
                 item.get_char() == item_t::char_cast('"'),
                 "process string has been called, but input does not contain any "
                 "strings");
 
-            size_t index = 1U;
+            // plain runs are copied at once, only escape sequences are unescaped
+            size_t index = copy_plain_chars(item, 1U, result);
+
+            while (item.get_char(index) != m_string_separator) {
+                if (item.get_char(index) == item_t::char_cast('\0')) {
+                    throw_if_can(
+                        false,
+                        "End of file reached, however end of string hasn't found");
+                    return index;
+                }
+
+                index = process_unique_char(index, item, result);
 
-            CERBLIB_UNROLL_N(2)
-            while (item.get_char(index) != item_t::char_cast('"')) {
-                throw_if_can(
-                    item.get_char(index) != item_t::char_cast('\0'),
-                    "End of file reached, however end of string hasn't found");
                 throw_if_can(
                     !(item.get_char(index) == item_t::char_cast('\n') &&
                       item.get_char(index - 1) == item_t::char_cast('\\')),
                     "String hasn't been closed on a line");
 
-                auto result_of_process =
-                    process_char(m_string_separator, index, item, result);
-                index = result_of_process.second;
-
-                if (result_of_process.first) {
-                    return index + 1;
-                }
+                index = copy_plain_chars(item, index, result);
             }
 
             return index + 1;
         }
 
     public:
+        /**
+         * @brief compiles all items and terminals into one DFA, after that scan
+         * finds tokens with a single table walk instead of checking every item
+         */
+        auto compile_dfa() -> void
+        {
+            if (!m_dfa.empty()) {
+                return;
+            }
+
+            DfaBuilder<CharT, TokenType> builder{ m_encoding };
+            auto keyword = m_keywords.begin();
+
+            // keywords go in the same order, as they went being items
+            CERBLIB_UNROLL_N(2)
+            for (const item_t &elem : m_items) {
+                for (; keyword != m_keywords.end() &&
+                       (keyword->priority < elem.priority ||
+                        (keyword->priority == elem.priority &&
+                         keyword->type < elem.get_type()));
+                     ++keyword) {
+                    builder.add_word(keyword->repr, keyword->type, keyword->priority);
+                }
+
+                builder.add_item(elem);
+            }
+
+            for (; keyword != m_keywords.end(); ++keyword) {
+                builder.add_word(keyword->repr, keyword->type, keyword->priority);
+            }
+
+            builder.add_terminals(m_context.checker);
+            m_dfa_tables = builder.build();
+            m_dfa        = m_dfa_tables.view();
+        }
+
+        CERBLIB_DECL auto get_dfa() const noexcept -> const dfa_t &
+        {
+            return m_dfa;
+        }
+
         CERBLIB_DECL auto get_input() const noexcept -> const string_view_t &
         {
             return head()->get_input();
         }
 
+        CERBLIB_DECL auto diagnostics() const noexcept
+            -> const std::vector<Diagnostic> &
+        {
+            return m_diagnostics;
+        }
+
+        /**
+         * @brief in recovery mode unknown tokens and broken char literals do not
+         * stop scanning: they are stored in diagnostics, the lexer skips them and
+         * goes on, so all errors are found in one pass
+         */
+        constexpr auto recover_errors(bool enable) noexcept -> void
+        {
+            m_recover_errors = enable;
+        }
+
+        /**
+         * @brief sets input for next_token and tokens, diagnostics are cleared
+         */
         constexpr auto
-            scan(const string_view_t &input, const string_view_t &filename) -> void
+            set_input(const string_view_t &input, const string_view_t &filename)
+                -> void
         {
+            m_diagnostics.clear();
+            m_input_begin   = input.begin();
+            m_pending_begin = m_pending_end = 0;
+            m_advance_item                  = nullptr;
+            m_finished                      = false;
+
             head()->set_input(input, filename);
             head()->skip_comments_and_layout();
             head()->dump();
+        }
+
+        /**
+         * @brief continues scanning from @p position, when the input has been
+         * moved to other buffer (see StreamLexer)
+         * @param line input, which begins with the current line
+         * @param offset index of the first not scanned character in @p line
+         */
+        constexpr auto
+            resume(const string_view_t &line, size_t offset, const position_t &position)
+                -> void
+        {
+            m_pending_begin = m_pending_end = 0;
+            m_advance_item                  = nullptr;
+            m_finished                      = false;
+            m_input_begin                   = line.begin();
+
+            m_context.input           = { line.begin() + offset, line.end() };
+            m_context.current_line    = line;
+            m_context.global_position = position;
+
+            head()->rebind();
+            head()->skip_comments_and_layout();
+            head()->dump();
+        }
+
+        /**
+         * @brief point, where the last skip of layout and comments stopped:
+         * after them or at the beginning of comment, which is not closed before
+         * the end of input (it is not scanned again, when input grows)
+         */
+        CERBLIB_DECL auto skipped() const -> Checkpoint
+        {
+            const auto &skipped = m_context.skipped;
+            return { skipped.input, skipped.line, skipped.position };
+        }
+
+        CERBLIB_DECL auto checkpoint() const -> Checkpoint
+        {
+            const auto &input = m_context.input;
+
+            if (m_advance_item == nullptr) {
+                return { input.begin(), m_context.current_line.begin(),
+                         m_context.global_position };
+            }
+
+            return { cerb::min(input.begin() + m_advance_skip, input.end()),
+                     m_context.current_line.begin(),
+                     m_advance_item->get_token_pos() + m_advance_shift };
+        }
+
+        /**
+         * @brief characters of the token, which has been returned by next_token
+         * the last time (string and char literals are taken with separators)
+         */
+        CERBLIB_DECL auto token_extent() const -> Pair<iterator_t, iterator_t>
+        {
+            if (m_finished) {
+                return { m_context.input.begin(), m_context.input.begin() };
+            }
+
+            // the second token of pair begins after the first one
+            const token_t &token = m_pending[m_pending_begin - 1];
+            iterator_t begin = m_pending_begin > 1 ? token.repr.begin() : token.location;
+            iterator_t end   = has_pending() ? token.repr.end() : checkpoint().input;
+
+            return { begin, end };
+        }
+
+        CERBLIB_DECL auto has_pending() const noexcept -> bool
+        {
+            return m_pending_begin != m_pending_end;
+        }
+
+        CERBLIB_DECL auto finished() const noexcept -> bool
+        {
+            return m_finished;
+        }
+
+        /**
+         * @brief frees unescaped string literals, tokens with them become invalid
+         */
+        auto clear_literals() -> void
+        {
+            m_strings.clear();
+        }
+
+        /**
+         * @brief scans input until next token is found. Pointer is valid until next
+         * call, the last token is EoF, after it nullptr is returned
+         */
+        auto next_token() -> const token_t *
+        {
+            if (m_pending_begin != m_pending_end) {
+                return &m_pending[m_pending_begin++];
+            }
+
+            m_pending_begin = m_pending_end = 0;
+            advance();
+
+            if (m_finished) {
+                return nullptr;
+            }
 
             size_t times = 0;
-            item_t *item = nullptr;
 
-            while (!item_t::empty()) {
+            while (!head()->empty()) {
                 head()->rebind();
-                auto tmp = manage_char_and_string();
 
-                if (tmp == FINISH) {
-                    return;
+                if (manage_char_and_string() ||
+                    (m_dfa.empty() ? match_with_items() : match_with_dfa())) {
+                    return &m_pending[m_pending_begin++];
                 }
-                if (tmp == CONTINUE) {
+
+                // failed match may have moved head, so it starts from the token
+                head()->rebind();
+                head()->skip_comments_and_layout();
+                head()->dump();
+                ++times;
+
+                if (times > 1 && m_recover_errors) {
+                    skip_unknown_token();
                     times = 0;
-                    continue;
+                } else if (times > 1) {
+                    derived().error(*head(), head()->isolate_token());
                 }
+            }
 
-                CERBLIB_UNROLL_N(2)
-                for (item_t &elem : m_items) {
-                    elem.rebind();
+            // the last token may be found by other item, so position is reloaded
+            m_finished = true;
+            head()->rebind();
+            push_pending({ repr4EoF, static_cast<TokenType>(EoF),
+                           head()->get_begin_of_token(), head()->get_token_pos() });
+            return &m_pending[m_pending_begin++];
+        }
 
-                    if (elem.check() == SCAN_FINISHED &&
-                        (item == nullptr || elem.dot() > item->dot())) {
-                        item = &elem;
-                        break;
-                    }
+        /**
+         * @brief scans up to @p buffer.size() tokens into @p buffer. Tokens are
+         * copies, so they stay valid until clear_literals
+         * @return number of tokens, 0 after EoF has been taken
+         */
+        auto next_tokens(std::span<token_t> buffer) -> size_t
+        {
+            size_t size = 0;
+
+            CERBLIB_UNROLL_N(1)
+            while (size != buffer.size()) {
+                const token_t *token = next_token();
+
+                if (token == nullptr) {
+                    break;
                 }
 
-                if (item != nullptr) {
-                    CERBLIB_UNROLL_N(1)
-                    for (const token_t &result : item->result()) {
-                        if (!yield(result)) {
-                            finish();
-                            return;
-                        }
-                    }
+                buffer[size++] = *token;
+            }
 
-                    item->add2input(item->dot());
-                    item->skip_comments_and_layout();
-                    item->dump();
-                    times = 0;
-                } else {
-                    head()->skip_comments_and_layout();
-                    head()->dump();
-                    ++times;
+            return size;
+        }
 
-                    if (times > 1) {
-                        error(*head(), head()->isolate_token());
-                    }
+        class TokenIterator
+        {
+            StaticLexicalAnalyzer *m_lexer{ nullptr };
+            const token_t *m_token{ nullptr };
+
+        public:
+            using value_type      = token_t;
+            using difference_type = std::ptrdiff_t;
+
+            CERBLIB_DECL auto operator*() const -> const token_t &
+            {
+                return *m_token;
+            }
+
+            CERBLIB_DECL auto operator->() const -> const token_t *
+            {
+                return m_token;
+            }
+
+            auto operator++() -> TokenIterator &
+            {
+                m_token = m_lexer->next_token();
+                return *this;
+            }
+
+            auto operator++(int) -> void
+            {
+                ++*this;
+            }
+
+            CERBLIB_DECL auto operator==(std::default_sentinel_t /*unused*/) const
+                -> bool
+            {
+                return m_token == nullptr;
+            }
+
+            TokenIterator() = default;
+
+            explicit TokenIterator(StaticLexicalAnalyzer &lexer)
+              : m_lexer(&lexer), m_token(lexer.next_token())
+            {}
+        };
+
+        struct TokenRange
+        {
+            StaticLexicalAnalyzer *lexer{ nullptr };
+
+            auto begin() const -> TokenIterator
+            {
+                return TokenIterator{ *lexer };
+            }
+
+            CERBLIB_DECL auto end() const -> std::default_sentinel_t
+            {
+                return std::default_sentinel;
+            }
+        };
+
+        /**
+         * @brief input range over tokens, tokens are scanned on demand
+         */
+        auto tokens(const string_view_t &input, const string_view_t &filename)
+            -> TokenRange
+        {
+            set_input(input, filename);
+            return { this };
+        }
+
+        constexpr auto
+            scan(const string_view_t &input, const string_view_t &filename) -> void
+        {
+            set_input(input, filename);
+
+            CERBLIB_UNROLL_N(1)
+            for (const token_t *token = next_token(); token != nullptr;
+                 token                = next_token()) {
+                if (!derived().yield(*token)) {
+                    break;
                 }
-                item = nullptr;
             }
-            yield({ repr4EoF, static_cast<TokenType>(EoF),
-                    head()->get_begin_of_token(), head()->get_token_pos() });
-            finish();
+
+            derived().finish();
+        }
+
+        /**
+         * @brief scans input and gives tokens to yield_batch by batches of
+         * @p buffer.size() tokens (BATCH_SIZE is a good choice). If yield_batch
+         * returns false, scanning stops after the batch
+         */
+        auto scan_batched(
+            const string_view_t &input, const string_view_t &filename,
+            std::span<token_t> buffer) -> void
+        {
+            throw_if_can(!buffer.empty(), "Buffer for batches of tokens is empty!");
+            set_input(input, filename);
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t size = next_tokens(buffer); size != 0;
+                 size        = next_tokens(buffer)) {
+                if (!derived().yield_batch(buffer.first(size))) {
+                    break;
+                }
+            }
+
+            derived().finish();
         }
 
     public:
-        constexpr virtual ~LexicalAnalyzer() = default;
+        constexpr ~StaticLexicalAnalyzer() = default;
+
+        // items keep pointer to the context of their lexer
+        StaticLexicalAnalyzer(const StaticLexicalAnalyzer &) = delete;
+        StaticLexicalAnalyzer(StaticLexicalAnalyzer &&)      = delete;
+
+        auto operator=(const StaticLexicalAnalyzer &) -> StaticLexicalAnalyzer & = delete;
+        auto operator=(StaticLexicalAnalyzer &&) -> StaticLexicalAnalyzer &      = delete;
+
+        constexpr StaticLexicalAnalyzer(
+            CharT string_separator,
+            CharT char_separator,
+            TokenType string_type,
+            TokenType char_type,
+            const std::initializer_list<const item_initializer>
+                rules,
+            const string_checker_t &terminals,
+            const string_view_t &single_line_comment,
+            const string_view_t &multiline_comment_begin,
+            const string_view_t &multiline_comment_end,
+            Encoding encoding = Encoding::BYTES)
+          : m_string_type(string_type), m_char_type(char_type),
+            m_string_separator(string_separator), m_char_separator(char_separator),
+            m_encoding(encoding)
+        {
+            std::vector<const item_initializer *> order{};
+            std::vector<item_t> spans{};
+
+            CERBLIB_UNROLL_N(2)
+            for (const item_initializer &rule : rules) {
+                if (!rule.word) {
+                    spans.emplace_back(rule, encoding);
+                }
+            }
 
-        constexpr LexicalAnalyzer(
+            CERBLIB_UNROLL_N(2)
+            for (const item_initializer &rule : rules) {
+                if (!add_keyword(spans, rule)) {
+                    order.push_back(&rule);
+                }
+            }
+
+            emplace_items(order);
+            m_keywords.build();
+            m_head            = m_items.data();
+            m_context.checker = terminals;
+            bind_items(
+                single_line_comment, multiline_comment_begin, multiline_comment_end);
+        }
+
+        /*
+         * lexer with keywords, which are hashed at compile time (cerb2lex puts
+         * words, which are taken whole by rules, in constexpr set), so words
+         * in rules are not checked by spans of rules
+         */
+        constexpr StaticLexicalAnalyzer(
             CharT string_separator,
             CharT char_separator,
             TokenType string_type,
             TokenType char_type,
             const std::initializer_list<const item_initializer>
                 rules,
+            const keyword_set_t &keywords,
+            const string_checker_t &terminals,
+            const string_view_t &single_line_comment,
+            const string_view_t &multiline_comment_begin,
+            const string_view_t &multiline_comment_end,
+            Encoding encoding = Encoding::BYTES)
+          : m_keywords(keywords), m_string_type(string_type), m_char_type(char_type),
+            m_string_separator(string_separator), m_char_separator(char_separator),
+            m_encoding(encoding)
+        {
+            std::vector<const item_initializer *> order{};
+
+            CERBLIB_UNROLL_N(2)
+            for (const item_initializer &rule : rules) {
+                order.push_back(&rule);
+            }
+
+            emplace_items(order);
+            m_head            = m_items.data();
+            m_context.checker = terminals;
+            bind_items(
+                single_line_comment, multiline_comment_begin, multiline_comment_end);
+        }
+
+        /*
+         * lexer, which scans with precomputed tables (cerb2lex -DFA),
+         * it has only one empty item to keep the input and position,
+         * terminals are kept to isolate unknown tokens
+         */
+        constexpr StaticLexicalAnalyzer(
+            CharT string_separator,
+            CharT char_separator,
+            TokenType string_type,
+            TokenType char_type,
+            const dfa_t &dfa,
             const string_checker_t &terminals,
             const string_view_t &single_line_comment,
             const string_view_t &multiline_comment_begin,
-            const string_view_t &multiline_comment_end)
-          : m_items(rules), m_head(m_items.begin()), m_string_type(string_type),
-            m_char_type(char_type), m_string_separator(string_separator),
-            m_char_separator(char_separator)
+            const string_view_t &multiline_comment_end,
+            Encoding encoding = Encoding::BYTES)
+          : m_dfa(dfa), m_string_type(string_type), m_char_type(char_type),
+            m_string_separator(string_separator), m_char_separator(char_separator),
+            m_encoding(encoding)
         {
-            item_t::set_terminals(terminals);
-            item_t::set_comments(
+            emplace_items({});
+            m_head            = m_items.data();
+            m_context.checker = terminals;
+            bind_items(
                 single_line_comment, multiline_comment_begin, multiline_comment_end);
         }
     };
+
+    /**
+     * @brief lexical analyzer with virtual yield, finish, error and process_string
+     */
+    template<
+        typename CharT,
+        typename TokenType,
+        bool MayThrow            = true,
+        size_t UID               = 0,
+        bool AllowStringLiterals = true,
+        bool AllowComments       = true,
+        size_t MaxTerminals      = 128,
+        size_t MaxSize4Terminals = 4,
+        bool TrackPositions      = true>
+    struct LexicalAnalyzer
+      : public StaticLexicalAnalyzer<
+            LexicalAnalyzer<
+                CharT,
+                TokenType,
+                MayThrow,
+                UID,
+                AllowStringLiterals,
+                AllowComments,
+                MaxTerminals,
+                MaxSize4Terminals,
+                TrackPositions>,
+            CharT,
+            TokenType,
+            MayThrow,
+            UID,
+            AllowStringLiterals,
+            AllowComments,
+            MaxTerminals,
+            MaxSize4Terminals,
+            TrackPositions>
+    {
+        using static_parent = StaticLexicalAnalyzer<
+            LexicalAnalyzer,
+            CharT,
+            TokenType,
+            MayThrow,
+            UID,
+            AllowStringLiterals,
+            AllowComments,
+            MaxTerminals,
+            MaxSize4Terminals,
+            TrackPositions>;
+
+        using item_t        = typename static_parent::item_t;
+        using token_t       = typename static_parent::token_t;
+        using string_t      = typename static_parent::string_t;
+        using string_view_t = typename static_parent::string_view_t;
+
+        using static_parent::static_parent;
+
+        virtual void finish()
+        {}
+
+        virtual bool yield(const token_t & /*token*/)
+        {
+            return true;
+        }
+
+        virtual bool yield_batch(std::span<const token_t> tokens)
+        {
+            return static_parent::yield_batch(tokens);
+        }
+
+        virtual void error(const item_t &item, const string_view_t &repr) = 0;
+
+        CERBLIB_DECL virtual auto process_string(item_t &item, string_t &result)
+            -> size_t
+        {
+            return static_parent::process_string(item, result);
+        }
+
+        constexpr virtual ~LexicalAnalyzer() = default;
+    };
 }// namespace cerb::lex
 
 #endif /* CERBERUS_LEX_HPP */
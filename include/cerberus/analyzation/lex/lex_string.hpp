@@ -1,6 +1,11 @@
 #ifndef CERBERUS_LEX_STRING_HPP
 #define CERBERUS_LEX_STRING_HPP
 
+#include <span>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <cerberus/pair.hpp>
 #include <cerberus/types.h>
 #include <cerberus/string_view.hpp>
 
@@ -32,7 +37,6 @@ namespace cerb::lex {
         size_t src_size    = src.size();
         size_t substr_size = substr.size();
 
-        CERBLIB_UNROLL_N(2)
         while (index + i < src_size && i < substr_size) {
             if (src[index + i] != substr[i]) {
                 return false;
@@ -43,47 +47,94 @@ namespace cerb::lex {
         return i == substr_size && !substr.empty();
     }
 
+    /**
+     * @brief terminals, which are stored in trie. Children of node are sorted
+     * and kept together, children of the root are also found by table for the
+     * first 256 characters. So the longest terminal is found in
+     * O(MaxLength4Terminal * log(children)) without any hashing
+     */
     template<
         typename CharT, typename TokenType, size_t MaxTerminals = 128,
         size_t MaxLength4Terminal = 8, bool MayThrow = true>
     struct TerminalContainer
     {
         constexpr static size_t MaxChars = (1ULL << bitsizeof(CharT)) - 1;
+        constexpr static size_t MaxNodes = MaxTerminals * MaxLength4Terminal + 1;
         using string_view_t              = basic_string_view<CharT>;
-        using bitmap_t                   = ConstBitmap<1, MaxChars>;
-        using storage_t                  = std::array<bitmap_t, MaxLength4Terminal>;
-        using map_t = gl::Map<uintmax_t, TokenType, MaxTerminals>;
+
+        static_assert(MaxNodes <= std::numeric_limits<u16>::max());
+
+        struct Terminal
+        {
+            std::array<CharT, MaxLength4Terminal> chars{};
+            size_t length{};
+            TokenType type{};
+
+        public:
+            CERBLIB_DECL auto repr() const -> string_view_t
+            {
+                return { chars.data(), length };
+            }
+        };
+
+        struct Node
+        {
+            u16 first_edge{};
+            u16 edges{};
+            u16 terminal{};// index of terminal + 1, 0 if node is not final
+        };
+
+        struct Edge
+        {
+            CharT chr{};
+            u16 node{};
+        };
+
+        using terminals_t = std::array<Terminal, MaxTerminals>;
 
     public:
+        CERBLIB_DECL auto terminals() const -> std::span<const Terminal>
+        {
+            return { m_terminals.data(), m_terminals_count };
+        }
+
+        /**
+         * @brief checks, that terminal begins with @p elem and returns type of
+         * one character terminal
+         */
         CERBLIB_DECL auto check(CharT elem) const -> Pair<bool, TokenType>
         {
-            auto hash = to_unsigned(elem);
-            return { static_cast<bool>(m_bitmaps[0].template at<0>(hash)),
-                     m_map.search(hash)->second };
+            u16 node = child(0, elem);
+            return { node != 0, type_of(node) };
         }
 
+        /**
+         * @brief finds the longest terminal at @p offset of @p str
+         */
         CERBLIB_DECL auto
             check(size_t offset, const string_view_t &str) const
             -> Pair<string_view_t, TokenType>
         {
-            size_t i    = 0;
-            size_t hash = 0;
+            u16 node     = 0;
+            u16 terminal = 0;
+            size_t size  = 0;
 
-            CERBLIB_UNROLL_N(2)
-            for (; i < str.size(); ++i) {
-                auto local_hash = to_unsigned(str[offset + i]);
+            for (size_t i = offset; i < str.size(); ++i) {
+                node = child(node, str[i]);
 
-                if (m_bitmaps[i].template at<0>(local_hash) == 0) {
+                if (node == 0) {
                     break;
                 }
 
-                hash = hash * 31U + local_hash;
+                if (m_nodes[node].terminal != 0) {
+                    terminal = m_nodes[node].terminal;
+                    size     = i - offset + 1;
+                }
             }
-            auto result = m_map.search(hash);
-            i           = cmov<size_t>(result == m_map.end(), 0, i);
 
-            return { { str.begin() + offset, str.begin() + i + offset },
-                     result->second };
+            return { { str.begin() + offset, str.begin() + offset + size },
+                     terminal == 0 ? TokenType{}
+                                   : m_terminals[terminal - 1].type };
         }
 
         consteval TerminalContainer() = default;
@@ -101,16 +152,11 @@ namespace cerb::lex {
 
             CERBLIB_UNROLL_N(4)
             for (const auto &elem : chars) {
-                auto hash = to_unsigned(elem.second);
-                m_map.emplace(hash, elem.first);
-                m_bitmaps[0].template set<1, 0>(hash);
+                add_terminal(elem.first, { &elem.second, 1 });
             }
 
             CERBLIB_UNROLL_N(2)
             for (const auto &elem : strings) {
-                size_t i    = 0;
-                size_t hash = 0;
-
                 if constexpr (MayThrow) {
                     if (MaxLength4Terminal <= elem.second.size()) {
                         throw std::out_of_range(
@@ -118,22 +164,149 @@ namespace cerb::lex {
                     }
                 }
 
-                CERBLIB_UNROLL_N(4)
-                for (const auto &chr : elem.second) {
-                    auto local_hash = to_unsigned(chr);
-                    hash            = hash * 31U + local_hash;
-                    m_bitmaps[i++].template set<1, 0>(local_hash);
+                add_terminal(elem.first, elem.second);
+            }
+
+            build_trie();
+        }
+
+        constexpr ~TerminalContainer() = default;
+
+    private:
+        CERBLIB_DECL auto type_of(u16 node) const -> TokenType
+        {
+            u16 terminal = m_nodes[node].terminal;
+            return terminal == 0 ? TokenType{} : m_terminals[terminal - 1].type;
+        }
+
+        // returns 0 if there is no edge, because the root can't be a child
+        CERBLIB_DECL auto child(u16 node, CharT chr) const -> u16
+        {
+            auto code = to_unsigned(chr);
+
+            if (node == 0 && code < m_root.size()) {
+                return m_root[code];
+            }
+
+            size_t first = m_nodes[node].first_edge;
+            size_t last  = first + m_nodes[node].edges;
+
+            CERBLIB_UNROLL_N(1)
+            while (first < last) {
+                size_t middle = first + (last - first) / 2;
+
+                if (m_edges[middle].chr < chr) {
+                    first = middle + 1;
+                } else {
+                    last = middle;
+                }
+            }
+
+            return first < m_nodes[node].first_edge + m_nodes[node].edges &&
+                           m_edges[first].chr == chr
+                       ? m_edges[first].node
+                       : static_cast<u16>(0);
+        }
+
+        constexpr auto add_terminal(TokenType type, const string_view_t &repr) -> void
+        {
+            auto &terminal = m_terminals[m_terminals_count++];
+
+            CERBLIB_UNROLL_N(4)
+            for (const auto &chr : repr) {
+                terminal.chars[terminal.length++] = chr;
+            }
+            terminal.type = type;
+        }
+
+        /*
+         * terminals are sorted (stable, so the first of equal terminals wins),
+         * after that terminals with the same prefix are neighbours and children
+         * of every node are allocated together
+         */
+        constexpr auto build_trie() -> void
+        {
+            std::array<u16, MaxTerminals> order{};
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != m_terminals_count; ++i) {
+                size_t j = i;
+
+                CERBLIB_UNROLL_N(1)
+                for (; j != 0 && m_terminals[i].repr() <
+                                     m_terminals[order[j - 1]].repr();
+                     --j) {
+                    order[j] = order[j - 1];
                 }
+                order[j] = static_cast<u16>(i);
+            }
 
-                m_map.emplace(hash, elem.first);
+            m_nodes_count = 1;
+            build_node(order, 0, 0, m_terminals_count, 0);
+
+            CERBLIB_UNROLL_N(4)
+            for (size_t i = 0; i != m_nodes[0].edges; ++i) {
+                const Edge &edge = m_edges[m_nodes[0].first_edge + i];
+                auto code        = to_unsigned(edge.chr);
+
+                if (code < m_root.size()) {
+                    m_root[code] = edge.node;
+                }
             }
         }
 
-        constexpr ~TerminalContainer() = default;
+        constexpr auto build_node(
+            const std::array<u16, MaxTerminals> &order, u16 node, size_t first,
+            size_t last, size_t depth) -> void
+        {
+            // terminal, which ends in this node, goes before its continuations
+            if (first != last && m_terminals[order[first]].length == depth) {
+                m_nodes[node].terminal = static_cast<u16>(order[first] + 1);
+
+                CERBLIB_UNROLL_N(1)
+                while (first != last && m_terminals[order[first]].length == depth) {
+                    ++first;
+                }
+            }
+
+            size_t children = 0;
+            m_nodes[node].first_edge = static_cast<u16>(m_edges_count);
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = first; i != last; ++i) {
+                CharT chr = m_terminals[order[i]].chars[depth];
+
+                if (i == first || m_edges[m_edges_count - 1].chr != chr) {
+                    m_edges[m_edges_count++] = { chr, static_cast<u16>(m_nodes_count++) };
+                    ++children;
+                }
+            }
+
+            m_nodes[node].edges = static_cast<u16>(children);
+
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != children; ++i) {
+                const Edge edge = m_edges[m_nodes[node].first_edge + i];
+                size_t end      = first;
+
+                CERBLIB_UNROLL_N(1)
+                while (end != last && m_terminals[order[end]].chars[depth] == edge.chr) {
+                    ++end;
+                }
+
+                build_node(order, edge.node, first, end, depth + 1);
+                first = end;
+            }
+        }
 
     private:
-        map_t m_map{};
-        storage_t m_bitmaps{};
+        std::array<u16, 256> m_root{};
+        std::array<Node, MaxNodes> m_nodes{};
+        std::array<Edge, MaxNodes> m_edges{};
+        terminals_t m_terminals{};
+        size_t m_terminals_count{};
+        size_t m_nodes_count{};
+        size_t m_edges_count{};
     };
 }// namespace cerb::lex
 
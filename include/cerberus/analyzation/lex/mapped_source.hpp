@@ -0,0 +1,192 @@
+#ifndef CERBERUS_LEX_MAPPED_SOURCE_HPP
+#define CERBERUS_LEX_MAPPED_SOURCE_HPP
+
+#include <string>
+#include <utility>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+#include <cerberus/types.h>
+#include <cerberus/string_view.hpp>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    define CERBERUS_HAS_MMAP 1
+#endif
+
+namespace cerb::lex {
+    /**
+     * @brief file, which is mapped into memory for reading, so lexer works with
+     * the page cache directly without copying it. Lexer expects '\0' after the
+     * input: bytes after the end of file on the last page are zeros, and when
+     * file ends on the page boundary an extra zero page is mapped (if
+     * @p zero_padding is set). Without mmap the file is read into a string
+     */
+    template<typename CharT = char>
+    class MappedSource
+    {
+        const CharT *m_data{ nullptr };
+        size_t m_size{ 0 };
+
+#ifdef CERBERUS_HAS_MMAP
+        void *m_mapping{ MAP_FAILED };
+        size_t m_mapping_size{ 0 };
+
+        static auto throw_system_error(const std::string &filename) -> void
+        {
+            throw std::system_error(
+                errno, std::generic_category(), "Unable to open file: " + filename);
+        }
+
+        auto map(int fd, size_t bytes, bool zero_padding) -> void
+        {
+            auto page          = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            bool needs_padding = zero_padding && bytes % page == 0;
+            m_mapping_size     = bytes + (needs_padding ? page : 0);
+
+            if (needs_padding) {
+                // zero page is reserved first, the file is mapped over its beginning
+                m_mapping = ::mmap(
+                    nullptr, m_mapping_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS,
+                    -1, 0);
+
+                if (m_mapping != MAP_FAILED && bytes != 0 &&
+                    ::mmap(
+                        m_mapping, bytes, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) ==
+                        MAP_FAILED) {
+                    ::munmap(m_mapping, m_mapping_size);
+                    m_mapping = MAP_FAILED;
+                }
+            } else {
+                m_mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+            }
+
+            if (m_mapping != MAP_FAILED) {
+                ::madvise(m_mapping, m_mapping_size, MADV_SEQUENTIAL);
+                m_data = static_cast<const CharT *>(m_mapping);
+                m_size = bytes / sizeof(CharT);
+            }
+        }
+
+        auto unmap() noexcept -> void
+        {
+            if (m_mapping != MAP_FAILED) {
+                ::munmap(m_mapping, m_mapping_size);
+                m_mapping = MAP_FAILED;
+            }
+        }
+#else
+        auto unmap() noexcept -> void
+        {}
+#endif
+
+        // used when file can't be mapped (for example, it is a pipe)
+        std::basic_string<CharT> m_fallback{};
+
+        auto read(const std::string &filename) -> void
+        {
+            std::basic_ifstream<CharT> file(filename);
+
+            if (!file.is_open()) {
+                throw std::system_error(
+                    std::make_error_code(std::errc::no_such_file_or_directory),
+                    "Unable to open file: " + filename);
+            }
+
+            std::basic_stringstream<CharT> buffer{};
+            buffer << file.rdbuf();
+            m_fallback = std::move(buffer).str();
+            m_data     = m_fallback.data();
+            m_size     = m_fallback.size();
+        }
+
+    public:
+        CERBLIB_DECL auto data() const noexcept -> const CharT *
+        {
+            return m_data;
+        }
+
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_size;
+        }
+
+        CERBLIB_DECL auto view() const noexcept -> basic_string_view<CharT>
+        {
+            return { m_data, m_size };
+        }
+
+        CERBLIB_DECL auto is_mapped() const noexcept -> bool
+        {
+#ifdef CERBERUS_HAS_MMAP
+            return m_mapping != MAP_FAILED;
+#else
+            return false;
+#endif
+        }
+
+        MappedSource() = default;
+
+        explicit MappedSource(const std::string &filename, bool zero_padding = true)
+        {
+#ifdef CERBERUS_HAS_MMAP
+            int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+
+            if (fd < 0) {
+                throw_system_error(filename);
+            }
+
+            struct stat status
+            {};
+
+            if (::fstat(fd, &status) == 0 && S_ISREG(status.st_mode)) {
+                map(fd, static_cast<size_t>(status.st_size), zero_padding);
+            }
+
+            ::close(fd);
+
+            if (m_mapping != MAP_FAILED) {
+                return;
+            }
+#endif
+            read(filename);
+        }
+
+        MappedSource(MappedSource &&other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        auto operator=(MappedSource &&other) noexcept -> MappedSource &
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            unmap();
+            bool mapped  = other.is_mapped();
+            m_fallback   = std::move(other.m_fallback);
+            m_data       = mapped ? other.m_data : m_fallback.data();
+            m_size       = std::exchange(other.m_size, 0);
+            other.m_data = nullptr;
+#ifdef CERBERUS_HAS_MMAP
+            m_mapping      = std::exchange(other.m_mapping, MAP_FAILED);
+            m_mapping_size = std::exchange(other.m_mapping_size, 0);
+#endif
+            return *this;
+        }
+
+        MappedSource(const MappedSource &) = delete;
+        auto operator=(const MappedSource &) -> MappedSource & = delete;
+
+        ~MappedSource()
+        {
+            unmap();
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_MAPPED_SOURCE_HPP */
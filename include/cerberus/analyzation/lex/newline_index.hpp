@@ -0,0 +1,114 @@
+#ifndef CERBERUS_LEX_NEWLINE_INDEX_HPP
+#define CERBERUS_LEX_NEWLINE_INDEX_HPP
+
+#include <bit>
+#include <vector>
+#include <algorithm>
+#include <cerberus/types.h>
+#include <cerberus/string_view.hpp>
+#include <cerberus/analyzation/lex/file.hpp>
+#include <cerberus/analyzation/lex/simd.hpp>
+
+namespace cerb::lex {
+    /**
+     * @brief offsets of all new lines of input, which are found in one pass.
+     * Position of any offset is found by binary search, so tokens may keep only
+     * their offsets and get line and column, when they are needed (for
+     * diagnostics, for example). Columns are counted as in DotItem: '\r' does
+     * not move the column
+     */
+    template<typename CharT>
+    class NewlineIndex
+    {
+        using string_view_t = basic_string_view<CharT>;
+
+        string_view_t m_input{};
+        string_view_t m_filename{};
+        std::vector<size_t> m_newlines{};
+
+        auto build() -> void
+        {
+            const CharT *first   = m_input.begin();
+            const CharT *last    = m_input.end();
+            const CharT *current = first;
+
+            if constexpr (simd::enabled<CharT>) {
+                CERBLIB_UNROLL_N(1)
+                for (; static_cast<size_t>(last - current) >= simd::width;
+                     current += simd::width) {
+                    auto mask = simd::Block::load(current).equal('\n');
+                    auto base = static_cast<size_t>(current - first);
+
+                    CERBLIB_UNROLL_N(1)
+                    for (; mask != 0; mask &= mask - 1) {
+                        m_newlines.push_back(
+                            base + static_cast<size_t>(std::countr_zero(mask)));
+                    }
+                }
+            }
+
+            CERBLIB_UNROLL_N(2)
+            for (; current != last; ++current) {
+                if (*current == static_cast<CharT>('\n')) {
+                    m_newlines.push_back(static_cast<size_t>(current - first));
+                }
+            }
+        }
+
+    public:
+        CERBLIB_DECL auto lines() const noexcept -> size_t
+        {
+            return m_newlines.size() + 1;
+        }
+
+        /**
+         * @brief number of line (from 0), which contains @p offset
+         */
+        CERBLIB_DECL auto line_of(size_t offset) const -> size_t
+        {
+            return static_cast<size_t>(
+                std::lower_bound(m_newlines.begin(), m_newlines.end(), offset) -
+                m_newlines.begin());
+        }
+
+        CERBLIB_DECL auto line_begin(size_t line) const -> size_t
+        {
+            return line == 0 ? 0 : m_newlines[line - 1] + 1;
+        }
+
+        CERBLIB_DECL auto line(size_t line) const -> string_view_t
+        {
+            size_t begin = line_begin(line);
+            size_t end   = line < m_newlines.size() ? m_newlines[line] : m_input.size();
+            return { m_input.begin() + begin, end - begin };
+        }
+
+        CERBLIB_DECL auto position(size_t offset) const -> PositionInFile<CharT>
+        {
+            size_t line  = line_of(offset);
+            size_t begin = line_begin(line);
+            auto carriages =
+                std::count(m_input.begin() + begin, m_input.begin() + offset, '\r');
+
+            return { line, offset - begin - static_cast<size_t>(carriages),
+                     m_filename };
+        }
+
+        CERBLIB_DECL auto position(const CharT *pointer) const -> PositionInFile<CharT>
+        {
+            return position(static_cast<size_t>(pointer - m_input.begin()));
+        }
+
+        NewlineIndex() = default;
+
+        explicit NewlineIndex(
+            const string_view_t &text, const string_view_t &filename = {})
+          : m_input(text), m_filename(filename)
+        {
+            m_newlines.reserve(text.size() / 32);
+            build();
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_NEWLINE_INDEX_HPP */
@@ -0,0 +1,553 @@
+#ifndef CERBERUS_LEX_NUMBER_HPP
+#define CERBERUS_LEX_NUMBER_HPP
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <charconv>
+#include <cerberus/pair.hpp>
+#include <cerberus/math.hpp>
+#include <cerberus/types.h>
+#include <cerberus/string_view.hpp>
+#include <cerberus/analyzation/lex/char.hpp>
+#include <cerberus/analyzation/lex/powers_of_five.hpp>
+
+namespace cerb::lex {
+    enum NumberKind : u8
+    {
+        NOT_NUMBER,
+        INTEGER_NUMBER,
+        FLOATING_NUMBER,
+        MALFORMED_NUMBER
+    };
+
+    /**
+     * @brief value of numeric token: unsigned integer or double (sign is a
+     * separate token), MALFORMED_NUMBER for overflow or wrong digits
+     */
+    struct NumericValue
+    {
+        u64 bits{ 0 };
+        NumberKind kind{ NOT_NUMBER };
+
+    public:
+        CERBLIB_DECL auto is_integer() const noexcept -> bool
+        {
+            return kind == INTEGER_NUMBER;
+        }
+
+        CERBLIB_DECL auto is_floating() const noexcept -> bool
+        {
+            return kind == FLOATING_NUMBER;
+        }
+
+        CERBLIB_DECL auto as_integer() const noexcept -> u64
+        {
+            return bits;
+        }
+
+        CERBLIB_DECL auto as_double() const noexcept -> double
+        {
+            return std::bit_cast<double>(bits);
+        }
+
+        CERBLIB_DECL static auto integer(u64 value) noexcept -> NumericValue
+        {
+            return { value, INTEGER_NUMBER };
+        }
+
+        CERBLIB_DECL static auto floating(double value) noexcept -> NumericValue
+        {
+            return { std::bit_cast<u64>(value), FLOATING_NUMBER };
+        }
+
+        CERBLIB_DECL static auto malformed() noexcept -> NumericValue
+        {
+            return { 0, MALFORMED_NUMBER };
+        }
+    };
+}// namespace cerb::lex
+
+namespace cerb::lex::number {
+    constexpr size_t MaxDigits = 19;// significant digits, which fit in u64
+
+    constexpr std::array<double, 23> ExactPowersOfTen{
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    // high and low halves of @p lhs * @p rhs
+    CERBLIB_DECL auto multiply(u64 lhs, u64 rhs) -> Pair<u64, u64>
+    {
+#ifdef __SIZEOF_INT128__
+        __extension__ using u128 = unsigned __int128;
+        auto product            = static_cast<u128>(lhs) * rhs;
+        return { static_cast<u64>(product >> 64U), static_cast<u64>(product) };
+#else
+        u64 lhs_low  = lhs & 0xFFFF'FFFFU;
+        u64 lhs_high = lhs >> 32U;
+        u64 rhs_low  = rhs & 0xFFFF'FFFFU;
+        u64 rhs_high = rhs >> 32U;
+
+        u64 low    = lhs_low * rhs_low;
+        u64 middle = lhs_high * rhs_low + (low >> 32U);
+        u64 high   = lhs_high * rhs_high + (middle >> 32U);
+        middle     = lhs_low * rhs_high + (middle & 0xFFFF'FFFFU);
+
+        return { high + (middle >> 32U), (middle << 32U) | (low & 0xFFFF'FFFFU) };
+#endif
+    }
+
+    template<typename CharT>
+    CERBLIB_DECL auto load_eight(const CharT *first) -> u64
+    {
+        u64 result = 0;
+
+        CERBLIB_UNROLL_N(8)
+        for (size_t i = 0; i != 8; ++i) {
+            result |= static_cast<u64>(static_cast<u8>(first[i])) << (8 * i);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief checks, that all 8 bytes of @p chunk (the first character is in the
+     * lowest byte) are decimal digits
+     */
+    CERBLIB_DECL auto is_eight_digits(u64 chunk) -> bool
+    {
+        return ((chunk & 0xF0F0'F0F0'F0F0'F0F0ULL) |
+                (((chunk + 0x0606'0606'0606'0606ULL) & 0xF0F0'F0F0'F0F0'F0F0ULL) >>
+                 4U)) == 0x3333'3333'3333'3333ULL;
+    }
+
+    /**
+     * @brief value of 8 decimal digits with 3 multiplications instead of 8
+     * (SWAR: pairs of digits, then pairs of pairs and so on)
+     */
+    CERBLIB_DECL auto parse_eight_digits(u64 chunk) -> u32
+    {
+        constexpr u64 mask       = 0x0000'00FF'0000'00FFULL;
+        constexpr u64 multiplier1 = 100 + (1'000'000ULL << 32U);
+        constexpr u64 multiplier2 = 1 + (10'000ULL << 32U);
+
+        chunk -= 0x3030'3030'3030'3030ULL;
+        chunk = (chunk * 10) + (chunk >> 8U);
+        chunk = (((chunk & mask) * multiplier1) +
+                 (((chunk >> 16U) & mask) * multiplier2)) >>
+                32U;
+
+        return static_cast<u32>(chunk);
+    }
+
+    /**
+     * @brief appends decimal digits from @p current to @p value (it wraps after
+     * MaxDigits digits) and counts them. Narrow characters go by 8 at once
+     */
+    template<typename CharT>
+    constexpr auto parse_digits(
+        const CharT *&current, const CharT *last, u64 &value, size_t &count) -> void
+    {
+        if constexpr (sizeof(CharT) == 1) {
+            while (last - current >= 8 && is_eight_digits(load_eight(current))) {
+                value = value * 100'000'000 + parse_eight_digits(load_eight(current));
+                current += 8;
+                count += 8;
+            }
+        }
+
+        for (; current != last && is_digit(*current); ++current, ++count) {
+            value = value * 10 + static_cast<u64>(*current - static_cast<CharT>('0'));
+        }
+    }
+
+    // value of hexadecimal digit or 16
+    template<typename CharT>
+    CERBLIB_DECL auto hex_digit(CharT chr) -> u64
+    {
+        if (is_digit(chr)) {
+            return static_cast<u64>(chr - static_cast<CharT>('0'));
+        }
+        if (chr >= static_cast<CharT>('a') && chr <= static_cast<CharT>('f')) {
+            return static_cast<u64>(chr - static_cast<CharT>('a')) + 10;
+        }
+        if (chr >= static_cast<CharT>('A') && chr <= static_cast<CharT>('F')) {
+            return static_cast<u64>(chr - static_cast<CharT>('A')) + 10;
+        }
+        return 16;
+    }
+
+    template<typename CharT>
+    CERBLIB_DECL auto skip_suffix(const CharT *current, const CharT *last, bool floating)
+        -> const CharT *
+    {
+        CERBLIB_UNROLL_N(1)
+        for (; current != last; ++current) {
+            switch (*current) {
+            case static_cast<CharT>('l'):
+            case static_cast<CharT>('L'):
+                continue;
+
+            case static_cast<CharT>('u'):
+            case static_cast<CharT>('U'):
+                if (floating) {
+                    return current;
+                }
+                continue;
+
+            case static_cast<CharT>('f'):
+            case static_cast<CharT>('F'):
+                if (!floating) {
+                    return current;
+                }
+                continue;
+
+            default:
+                return current;
+            }
+        }
+        return current;
+    }
+
+    /**
+     * @brief decodes integer literal: decimal, hexadecimal after "0x" and octal
+     * after '0' (digits are the same as in "\x" and "\0" escape sequences), C
+     * suffixes (u, l) are skipped
+     */
+    template<typename CharT>
+    CERBLIB_DECL auto parse_integer(const basic_string_view<CharT> &repr) -> NumericValue
+    {
+        const CharT *current = repr.begin();
+        const CharT *last    = repr.end();
+        u64 value            = 0;
+
+        if (current == last || !is_digit(*current)) {
+            return NumericValue::malformed();
+        }
+
+        if (*current == static_cast<CharT>('0') && last - current > 1) {
+            bool hexadecimal =
+                current[1] == static_cast<CharT>('x') || current[1] == static_cast<CharT>('X');
+            u64 base     = hexadecimal ? 16 : 8;
+            const CharT *digits = current + (hexadecimal ? 2 : 1);
+
+            for (current = digits; current != last && hex_digit(*current) < base;
+                 ++current) {
+                if (value > (std::numeric_limits<u64>::max() >> (hexadecimal ? 4U : 3U))) {
+                    return NumericValue::malformed();
+                }
+                value = value * base + hex_digit(*current);
+            }
+
+            if ((hexadecimal && current == digits) ||
+                skip_suffix(current, last, false) != last) {
+                return NumericValue::malformed();
+            }
+
+            return NumericValue::integer(value);
+        }
+
+        const CharT *first = current;
+        size_t count       = 0;
+        parse_digits(current, last, value, count);
+
+        // 20 digits fit in u64 only if they begin with 1 and have not wrapped
+        if (count > MaxDigits + 1 ||
+            (count == MaxDigits + 1 &&
+             (*first != static_cast<CharT>('1') || value < 10'000'000'000'000'000'000ULL))) {
+            return NumericValue::malformed();
+        }
+
+        if (skip_suffix(current, last, false) != last) {
+            return NumericValue::malformed();
+        }
+
+        return NumericValue::integer(value);
+    }
+
+    /**
+     * @brief Eisel-Lemire algorithm: @p mantissa * 10^@p exponent is rounded to
+     * double with one or two multiplications by 128-bit power of five
+     * @return bits of double and false, if the product is too close to the
+     * middle between two doubles, so the slow path is needed
+     */
+    CERBLIB_DECL auto eisel_lemire(u64 mantissa, i64 exponent) -> Pair<u64, bool>
+    {
+        constexpr u64 MantissaBits  = 52;
+        constexpr i64 InfinitePower = 0x7FF;
+
+        if (mantissa == 0 || exponent < SmallestPower) {
+            return { 0, true };
+        }
+
+        if (exponent > LargestPower) {
+            return { static_cast<u64>(InfinitePower) << MantissaBits, true };
+        }
+
+        auto leading_zeros = std::countl_zero(mantissa);
+        mantissa <<= static_cast<u64>(leading_zeros);
+
+        auto index    = static_cast<size_t>(exponent - SmallestPower) * 2;
+        auto product  = multiply(mantissa, PowersOfFive[index]);
+        constexpr u64 precision_mask = std::numeric_limits<u64>::max() >> (MantissaBits + 3);
+
+        if ((product.first & precision_mask) == precision_mask) {
+            auto second = multiply(mantissa, PowersOfFive[index + 1]);
+            product.second += second.first;
+            product.first += product.second < second.first ? 1 : 0;
+        }
+
+        // lower bits are unknown, they are exact only for small exponents
+        if (product.second == std::numeric_limits<u64>::max() &&
+            (exponent < -27 || exponent > 55)) {
+            return { 0, false };
+        }
+
+        u64 upper_bit = product.first >> 63U;
+        u64 result    = product.first >> (upper_bit + 64 - MantissaBits - 3);
+        i64 power     = (((152'170 + 65'536) * exponent) >> 16) + 63 +
+                    static_cast<i64>(upper_bit) - leading_zeros + 1023;
+
+        if (power <= 0) {// subnormal
+            if (-power + 1 >= 64) {
+                return { 0, true };
+            }
+
+            result >>= static_cast<u64>(-power + 1);
+            result += result & 1U;
+            result >>= 1U;
+            power = result < (u64{ 1 } << MantissaBits) ? 0 : 1;
+            return { result | (static_cast<u64>(power) << MantissaBits), true };
+        }
+
+        // exactly in the middle, round to even
+        if (product.second <= 1 && exponent >= -4 && exponent <= 23 &&
+            (result & 3U) == 1 &&
+            (result << (upper_bit + 64 - MantissaBits - 3)) == product.first) {
+            result &= ~u64{ 1 };
+        }
+
+        result += result & 1U;
+        result >>= 1U;
+
+        if (result >= (u64{ 2 } << MantissaBits)) {
+            result = u64{ 1 } << MantissaBits;
+            ++power;
+        }
+
+        result &= ~(u64{ 1 } << MantissaBits);
+
+        if (power >= InfinitePower) {
+            return { static_cast<u64>(InfinitePower) << MantissaBits, true };
+        }
+
+        return { result | (static_cast<u64>(power) << MantissaBits), true };
+    }
+
+    /**
+     * @brief decodes floating literal (digits, optional fraction and exponent,
+     * C suffixes f and l are skipped, value is double). Literals with more than
+     * MaxDigits significant digits and rare halfway cases go to std::from_chars
+     */
+    template<typename CharT>
+    auto parse_floating(const basic_string_view<CharT> &repr) -> NumericValue
+    {
+        const CharT *first   = repr.begin();
+        const CharT *current = first;
+        const CharT *last    = repr.end();
+        u64 mantissa         = 0;
+        size_t count         = 0;
+        i64 exponent         = 0;
+
+        parse_digits(current, last, mantissa, count);
+        size_t integer_digits = count;
+
+        if (current != last && *current == static_cast<CharT>('.')) {
+            ++current;
+            parse_digits(current, last, mantissa, count);
+            exponent = -static_cast<i64>(count - integer_digits);
+        }
+
+        if (count == 0) {
+            return NumericValue::malformed();
+        }
+
+        if (current != last &&
+            (*current == static_cast<CharT>('e') || *current == static_cast<CharT>('E'))) {
+            bool negative = ++current != last && *current == static_cast<CharT>('-');
+            current += current != last && (negative || *current == static_cast<CharT>('+'));
+
+            if (current == last || !is_digit(*current)) {
+                return NumericValue::malformed();
+            }
+
+            i64 explicit_exponent = 0;
+
+            for (; current != last && is_digit(*current); ++current) {
+                explicit_exponent = cerb::min<i64>(
+                    explicit_exponent * 10 + (*current - static_cast<CharT>('0')),
+                    0x10000);
+            }
+
+            exponent += negative ? -explicit_exponent : explicit_exponent;
+        }
+
+        const CharT *end = current;
+
+        if (skip_suffix(current, last, true) != last) {
+            return NumericValue::malformed();
+        }
+
+        // leading zeros are not significant
+        if (count > MaxDigits) {
+            for (const CharT *i = first; i != end && (*i == '0' || *i == '.'); ++i) {
+                count -= *i == '0' ? 1 : 0;
+            }
+        }
+
+        if (count <= MaxDigits) {
+            if (exponent >= -22 && exponent <= 22 && mantissa <= (u64{ 1 } << 53U)) {
+                auto value = static_cast<double>(mantissa);
+                auto power = ExactPowersOfTen[static_cast<size_t>(exponent < 0 ? -exponent : exponent)];
+                return NumericValue::floating(exponent < 0 ? value / power : value * power);
+            }
+
+            auto [bits, succeeded] = eisel_lemire(mantissa, exponent);
+
+            if (succeeded) {
+                return { bits, FLOATING_NUMBER };
+            }
+        }
+
+        std::string narrow(first, end);
+        double value = 0;
+        auto [pointer, error] =
+            std::from_chars(narrow.data(), narrow.data() + narrow.size(), value);
+
+        if (error == std::errc::result_out_of_range) {
+            value = exponent > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+        } else if (error != std::errc{}) {
+            return NumericValue::malformed();
+        }
+
+        return NumericValue::floating(value);
+    }
+
+    template<typename CharT>
+    auto decode(const basic_string_view<CharT> &repr, NumberKind kind) -> NumericValue
+    {
+        switch (kind) {
+        case INTEGER_NUMBER:
+            return parse_integer(repr);
+
+        case FLOATING_NUMBER:
+            return parse_floating(repr);
+
+        default:
+            return {};
+        }
+    }
+}// namespace cerb::lex::number
+
+namespace cerb::lex {
+    /**
+     * @brief decoded values of numeric tokens, they are kept apart from tokens,
+     * so tokens don't grow, when numbers are not decoded. Value is found by the
+     * beginning of its token, so copies of token (and TokenBuffer views) find it
+     * too. Tokens must be added in order of input
+     */
+    template<typename CharT, typename TokenType>
+    class NumberIndex
+    {
+        using iterator_t = typename basic_string_view<CharT>::iterator;
+
+        std::array<Pair<TokenType, NumberKind>, 8> m_types{};
+        size_t m_types_count{ 0 };
+        std::vector<Pair<iterator_t, NumericValue>> m_values{};
+
+        CERBLIB_DECL auto kind_of(TokenType type) const -> NumberKind
+        {
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != m_types_count; ++i) {
+                if (m_types[i].first == type) {
+                    return m_types[i].second;
+                }
+            }
+            return NOT_NUMBER;
+        }
+
+    public:
+        /**
+         * @brief tokens of @p type get decoded value of @p kind: INTEGER_NUMBER
+         * (decimal, 0x hexadecimal and 0 octal) or FLOATING_NUMBER
+         */
+        constexpr auto decode_numbers(TokenType type, NumberKind kind) -> void
+        {
+            CERBLIB_UNROLL_N(1)
+            for (size_t i = 0; i != m_types_count; ++i) {
+                if (m_types[i].first == type) {
+                    m_types[i].second = kind;
+                    return;
+                }
+            }
+
+            if (m_types_count == m_types.size()) {
+                throw std::out_of_range("Too many types of numeric tokens!");
+            }
+
+            m_types[m_types_count++] = { type, kind };
+        }
+
+        /**
+         * @brief decodes @p token, if its type has been registered by
+         * decode_numbers, other tokens are ignored
+         */
+        template<typename Token>
+        auto add(const Token &token) -> void
+        {
+            NumberKind kind = kind_of(token.type);
+
+            if (kind != NOT_NUMBER) {
+                m_values.push_back(
+                    { token.repr.begin(), number::decode(token.repr, kind) });
+            }
+        }
+
+        /**
+         * @brief value of @p token, NOT_NUMBER if it has not been decoded
+         */
+        template<typename Token>
+        CERBLIB_DECL auto find(const Token &token) const -> NumericValue
+        {
+            iterator_t location = token.repr.begin();
+            auto value          = std::partition_point(
+                m_values.begin(), m_values.end(),
+                [location](const auto &elem) { return elem.first < location; });
+
+            if (value == m_values.end() || value->first != location) {
+                return {};
+            }
+            return value->second;
+        }
+
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_values.size();
+        }
+
+        /**
+         * @brief forgets values, types of numeric tokens are kept
+         */
+        auto clear() -> void
+        {
+            m_values.clear();
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_NUMBER_HPP */
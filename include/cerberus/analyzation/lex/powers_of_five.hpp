@@ -0,0 +1,673 @@
+#ifndef CERBERUS_LEX_POWERS_OF_FIVE_HPP
+#define CERBERUS_LEX_POWERS_OF_FIVE_HPP
+
+#include <array>
+#include <cerberus/types.h>
+
+namespace cerb::lex::number {
+    constexpr i64 SmallestPower = -342;// 10^-343 and less round to zero
+    constexpr i64 LargestPower  = 308; // 10^309 and more round to infinity
+
+    /*
+     * 128-bit approximations of 5^q for q in [SmallestPower, LargestPower], as
+     * Eisel-Lemire algorithm requires: the most significant 128 bits of 5^q for
+     * q >= 0 and floor(2^b / 5^-q) + 1 for q < 0, where b is the bit length of
+     * 5^-q plus 127 (q >= -27) or twice the bit length plus 128. The table is a
+     * literal, so headers, which include it, compile fast
+     */
+    constexpr std::array<u64, 2 * (LargestPower - SmallestPower + 1)> PowersOfFive{
+        0xEEF4'53D6'923B'D65AULL, 0x113F'AA29'06A1'3B3FULL,// 5^-342
+        0x9558'B466'1B65'65F8ULL, 0x4AC7'CA59'A424'C507ULL,// 5^-341
+        0xBAAE'E17F'A23E'BF76ULL, 0x5D79'BCF0'0D2D'F649ULL,// 5^-340
+        0xE95A'99DF'8ACE'6F53ULL, 0xF4D8'2C2C'1079'73DCULL,// 5^-339
+        0x91D8'A02B'B6C1'0594ULL, 0x7907'1B9B'8A4B'E869ULL,// 5^-338
+        0xB64E'C836'A471'46F9ULL, 0x9748'E282'6CDE'E284ULL,// 5^-337
+        0xE3E2'7A44'4D8D'98B7ULL, 0xFD1B'1B23'0816'9B25ULL,// 5^-336
+        0x8E6D'8C6A'B078'7F72ULL, 0xFE30'F0F5'E50E'20F7ULL,// 5^-335
+        0xB208'EF85'5C96'9F4FULL, 0xBDBD'2D33'5E51'A935ULL,// 5^-334
+        0xDE8B'2B66'B3BC'4723ULL, 0xAD2C'7880'35E6'1382ULL,// 5^-333
+        0x8B16'FB20'3055'AC76ULL, 0x4C3B'CB50'21AF'CC31ULL,// 5^-332
+        0xADDC'B9E8'3C6B'1793ULL, 0xDF4A'BE24'2A1B'BF3DULL,// 5^-331
+        0xD953'E862'4B85'DD78ULL, 0xD71D'6DAD'34A2'AF0DULL,// 5^-330
+        0x87D4'713D'6F33'AA6BULL, 0x8672'648C'40E5'AD68ULL,// 5^-329
+        0xA9C9'8D8C'CB00'9506ULL, 0x680E'FDAF'511F'18C2ULL,// 5^-328
+        0xD43B'F0EF'FDC0'BA48ULL, 0x0212'BD1B'2566'DEF2ULL,// 5^-327
+        0x84A5'7695'FE98'746DULL, 0x014B'B630'F760'4B57ULL,// 5^-326
+        0xA5CE'D43B'7E3E'9188ULL, 0x419E'A3BD'3538'5E2DULL,// 5^-325
+        0xCF42'894A'5DCE'35EAULL, 0x5206'4CAC'8286'75B9ULL,// 5^-324
+        0x8189'95CE'7AA0'E1B2ULL, 0x7343'EFEB'D194'0993ULL,// 5^-323
+        0xA1EB'FB42'1949'1A1FULL, 0x1014'EBE6'C5F9'0BF8ULL,// 5^-322
+        0xCA66'FA12'9F9B'60A6ULL, 0xD41A'26E0'7777'4EF6ULL,// 5^-321
+        0xFD00'B897'4782'38D0ULL, 0x8920'B098'9555'22B4ULL,// 5^-320
+        0x9E20'735E'8CB1'6382ULL, 0x55B4'6E5F'5D55'35B0ULL,// 5^-319
+        0xC5A8'9036'2FDD'BC62ULL, 0xEB21'89F7'34AA'831DULL,// 5^-318
+        0xF712'B443'BBD5'2B7BULL, 0xA5E9'EC75'01D5'23E4ULL,// 5^-317
+        0x9A6B'B0AA'5565'3B2DULL, 0x47B2'33C9'2125'366EULL,// 5^-316
+        0xC106'9CD4'EABE'89F8ULL, 0x999E'C0BB'696E'840AULL,// 5^-315
+        0xF148'440A'256E'2C76ULL, 0xC006'70EA'43CA'250DULL,// 5^-314
+        0x96CD'2A86'5764'DBCAULL, 0x3804'0692'6A5E'5728ULL,// 5^-313
+        0xBC80'7527'ED3E'12BCULL, 0xC605'0837'04F5'ECF2ULL,// 5^-312
+        0xEBA0'9271'E88D'976BULL, 0xF786'4A44'C633'682EULL,// 5^-311
+        0x9344'5B87'3158'7EA3ULL, 0x7AB3'EE6A'FBE0'211DULL,// 5^-310
+        0xB815'7268'FDAE'9E4CULL, 0x5960'EA05'BAD8'2964ULL,// 5^-309
+        0xE61A'CF03'3D1A'45DFULL, 0x6FB9'2487'298E'33BDULL,// 5^-308
+        0x8FD0'C162'0630'6BABULL, 0xA5D3'B6D4'79F8'E056ULL,// 5^-307
+        0xB3C4'F1BA'87BC'8696ULL, 0x8F48'A489'9877'186CULL,// 5^-306
+        0xE0B6'2E29'29AB'A83CULL, 0x331A'CDAB'FE94'DE87ULL,// 5^-305
+        0x8C71'DCD9'BA0B'4925ULL, 0x9FF0'C08B'7F1D'0B14ULL,// 5^-304
+        0xAF8E'5410'288E'1B6FULL, 0x07EC'F0AE'5EE4'4DD9ULL,// 5^-303
+        0xDB71'E914'32B1'A24AULL, 0xC9E8'2CD9'F69D'6150ULL,// 5^-302
+        0x8927'31AC'9FAF'056EULL, 0xBE31'1C08'3A22'5CD2ULL,// 5^-301
+        0xAB70'FE17'C79A'C6CAULL, 0x6DBD'630A'48AA'F406ULL,// 5^-300
+        0xD64D'3D9D'B981'787DULL, 0x092C'BBCC'DAD5'B108ULL,// 5^-299
+        0x85F0'4682'93F0'EB4EULL, 0x25BB'F560'08C5'8EA5ULL,// 5^-298
+        0xA76C'5823'38ED'2621ULL, 0xAF2A'F2B8'0AF6'F24EULL,// 5^-297
+        0xD147'6E2C'0728'6FAAULL, 0x1AF5'AF66'0DB4'AEE1ULL,// 5^-296
+        0x82CC'A4DB'8479'45CAULL, 0x50D9'8D9F'C890'ED4DULL,// 5^-295
+        0xA37F'CE12'6597'973CULL, 0xE50F'F107'BAB5'28A0ULL,// 5^-294
+        0xCC5F'C196'FEFD'7D0CULL, 0x1E53'ED49'A962'72C8ULL,// 5^-293
+        0xFF77'B1FC'BEBC'DC4FULL, 0x25E8'E89C'13BB'0F7AULL,// 5^-292
+        0x9FAA'CF3D'F736'09B1ULL, 0x77B1'9161'8C54'E9ACULL,// 5^-291
+        0xC795'830D'7503'8C1DULL, 0xD59D'F5B9'EF6A'2417ULL,// 5^-290
+        0xF97A'E3D0'D244'6F25ULL, 0x4B05'7328'6B44'AD1DULL,// 5^-289
+        0x9BEC'CE62'836A'C577ULL, 0x4EE3'67F9'430A'EC32ULL,// 5^-288
+        0xC2E8'01FB'2445'76D5ULL, 0x229C'41F7'93CD'A73FULL,// 5^-287
+        0xF3A2'0279'ED56'D48AULL, 0x6B43'5275'78C1'110FULL,// 5^-286
+        0x9845'418C'3456'44D6ULL, 0x830A'1389'6B78'AAA9ULL,// 5^-285
+        0xBE56'91EF'416B'D60CULL, 0x23CC'986B'C656'D553ULL,// 5^-284
+        0xEDEC'366B'11C6'CB8FULL, 0x2CBF'BE86'B7EC'8AA8ULL,// 5^-283
+        0x94B3'A202'EB1C'3F39ULL, 0x7BF7'D714'32F3'D6A9ULL,// 5^-282
+        0xB9E0'8A83'A5E3'4F07ULL, 0xDAF5'CCD9'3FB0'CC53ULL,// 5^-281
+        0xE858'AD24'8F5C'22C9ULL, 0xD1B3'400F'8F9C'FF68ULL,// 5^-280
+        0x9137'6C36'D999'95BEULL, 0x2310'0809'B9C2'1FA1ULL,// 5^-279
+        0xB585'4744'8FFF'FB2DULL, 0xABD4'0A0C'2832'A78AULL,// 5^-278
+        0xE2E6'9915'B3FF'F9F9ULL, 0x16C9'0C8F'323F'516CULL,// 5^-277
+        0x8DD0'1FAD'907F'FC3BULL, 0xAE3D'A7D9'7F67'92E3ULL,// 5^-276
+        0xB144'2798'F49F'FB4AULL, 0x99CD'11CF'DF41'779CULL,// 5^-275
+        0xDD95'317F'31C7'FA1DULL, 0x4040'5643'D711'D583ULL,// 5^-274
+        0x8A7D'3EEF'7F1C'FC52ULL, 0x4828'35EA'666B'2572ULL,// 5^-273
+        0xAD1C'8EAB'5EE4'3B66ULL, 0xDA32'4365'0005'EECFULL,// 5^-272
+        0xD863'B256'369D'4A40ULL, 0x90BE'D43E'4007'6A82ULL,// 5^-271
+        0x873E'4F75'E222'4E68ULL, 0x5A77'44A6'E804'A291ULL,// 5^-270
+        0xA90D'E353'5AAA'E202ULL, 0x7115'15D0'A205'CB36ULL,// 5^-269
+        0xD351'5C28'3155'9A83ULL, 0x0D5A'5B44'CA87'3E03ULL,// 5^-268
+        0x8412'D999'1ED5'8091ULL, 0xE858'790A'FE94'86C2ULL,// 5^-267
+        0xA517'8FFF'668A'E0B6ULL, 0x626E'974D'BE39'A872ULL,// 5^-266
+        0xCE5D'73FF'402D'98E3ULL, 0xFB0A'3D21'2DC8'128FULL,// 5^-265
+        0x80FA'687F'881C'7F8EULL, 0x7CE6'6634'BC9D'0B99ULL,// 5^-264
+        0xA139'029F'6A23'9F72ULL, 0x1C1F'FFC1'EBC4'4E80ULL,// 5^-263
+        0xC987'4347'44AC'874EULL, 0xA327'FFB2'66B5'6220ULL,// 5^-262
+        0xFBE9'1419'15D7'A922ULL, 0x4BF1'FF9F'0062'BAA8ULL,// 5^-261
+        0x9D71'AC8F'ADA6'C9B5ULL, 0x6F77'3FC3'603D'B4A9ULL,// 5^-260
+        0xC4CE'17B3'9910'7C22ULL, 0xCB55'0FB4'384D'21D3ULL,// 5^-259
+        0xF601'9DA0'7F54'9B2BULL, 0x7E2A'53A1'4660'6A48ULL,// 5^-258
+        0x99C1'0284'4F94'E0FBULL, 0x2EDA'7444'CBFC'426DULL,// 5^-257
+        0xC031'4325'637A'1939ULL, 0xFA91'1155'FEFB'5308ULL,// 5^-256
+        0xF03D'93EE'BC58'9F88ULL, 0x7935'55AB'7EBA'27CAULL,// 5^-255
+        0x9626'7C75'35B7'63B5ULL, 0x4BC1'558B'2F34'58DEULL,// 5^-254
+        0xBBB0'1B92'8325'3CA2ULL, 0x9EB1'AAED'FB01'6F16ULL,// 5^-253
+        0xEA9C'2277'23EE'8BCBULL, 0x465E'15A9'79C1'CADCULL,// 5^-252
+        0x92A1'958A'7675'175FULL, 0x0BFA'CD89'EC19'1EC9ULL,// 5^-251
+        0xB749'FAED'1412'5D36ULL, 0xCEF9'80EC'671F'667BULL,// 5^-250
+        0xE51C'79A8'5916'F484ULL, 0x82B7'E127'80E7'401AULL,// 5^-249
+        0x8F31'CC09'37AE'58D2ULL, 0xD1B2'ECB8'B090'8810ULL,// 5^-248
+        0xB2FE'3F0B'8599'EF07ULL, 0x861F'A7E6'DCB4'AA15ULL,// 5^-247
+        0xDFBD'CECE'6700'6AC9ULL, 0x67A7'91E0'93E1'D49AULL,// 5^-246
+        0x8BD6'A141'0060'42BDULL, 0xE0C8'BB2C'5C6D'24E0ULL,// 5^-245
+        0xAECC'4991'4078'536DULL, 0x58FA'E9F7'7388'6E18ULL,// 5^-244
+        0xDA7F'5BF5'9096'6848ULL, 0xAF39'A475'506A'899EULL,// 5^-243
+        0x888F'9979'7A5E'012DULL, 0x6D84'06C9'5242'9603ULL,// 5^-242
+        0xAAB3'7FD7'D8F5'8178ULL, 0xC8E5'087B'A6D3'3B83ULL,// 5^-241
+        0xD560'5FCD'CF32'E1D6ULL, 0xFB1E'4A9A'9088'0A64ULL,// 5^-240
+        0x855C'3BE0'A17F'CD26ULL, 0x5CF2'EEA0'9A55'067FULL,// 5^-239
+        0xA6B3'4AD8'C9DF'C06FULL, 0xF42F'AA48'C0EA'481EULL,// 5^-238
+        0xD060'1D8E'FC57'B08BULL, 0xF13B'94DA'F124'DA26ULL,// 5^-237
+        0x823C'1279'5DB6'CE57ULL, 0x76C5'3D08'D6B7'0858ULL,// 5^-236
+        0xA2CB'1717'B524'81EDULL, 0x5476'8C4B'0C64'CA6EULL,// 5^-235
+        0xCB7D'DCDD'A26D'A268ULL, 0xA994'2F5D'CF7D'FD09ULL,// 5^-234
+        0xFE5D'5415'0B09'0B02ULL, 0xD3F9'3B35'435D'7C4CULL,// 5^-233
+        0x9EFA'548D'26E5'A6E1ULL, 0xC47B'C501'4A1A'6DAFULL,// 5^-232
+        0xC6B8'E9B0'709F'109AULL, 0x359A'B641'9CA1'091BULL,// 5^-231
+        0xF867'241C'8CC6'D4C0ULL, 0xC301'63D2'03C9'4B62ULL,// 5^-230
+        0x9B40'7691'D7FC'44F8ULL, 0x79E0'DE63'425D'CF1DULL,// 5^-229
+        0xC210'9436'4DFB'5636ULL, 0x9859'15FC'12F5'42E4ULL,// 5^-228
+        0xF294'B943'E17A'2BC4ULL, 0x3E6F'5B7B'17B2'939DULL,// 5^-227
+        0x979C'F3CA'6CEC'5B5AULL, 0xA705'992C'EECF'9C42ULL,// 5^-226
+        0xBD84'30BD'0827'7231ULL, 0x50C6'FF78'2A83'8353ULL,// 5^-225
+        0xECE5'3CEC'4A31'4EBDULL, 0xA4F8'BF56'3524'6428ULL,// 5^-224
+        0x940F'4613'AE5E'D136ULL, 0x871B'7795'E136'BE99ULL,// 5^-223
+        0xB913'1798'99F6'8584ULL, 0x28E2'557B'5984'6E3FULL,// 5^-222
+        0xE757'DD7E'C074'26E5ULL, 0x331A'EADA'2FE5'89CFULL,// 5^-221
+        0x9096'EA6F'3848'984FULL, 0x3FF0'D2C8'5DEF'7621ULL,// 5^-220
+        0xB4BC'A50B'065A'BE63ULL, 0x0FED'077A'756B'53A9ULL,// 5^-219
+        0xE1EB'CE4D'C7F1'6DFBULL, 0xD3E8'4959'12C6'2894ULL,// 5^-218
+        0x8D33'60F0'9CF6'E4BDULL, 0x6471'2DD7'ABBB'D95CULL,// 5^-217
+        0xB080'392C'C434'9DECULL, 0xBD8D'794D'96AA'CFB3ULL,// 5^-216
+        0xDCA0'4777'F541'C567ULL, 0xECF0'D7A0'FC55'83A0ULL,// 5^-215
+        0x89E4'2CAA'F949'1B60ULL, 0xF416'86C4'9DB5'7244ULL,// 5^-214
+        0xAC5D'37D5'B79B'6239ULL, 0x311C'2875'C522'CED5ULL,// 5^-213
+        0xD774'85CB'2582'3AC7ULL, 0x7D63'3293'366B'828BULL,// 5^-212
+        0x86A8'D39E'F771'64BCULL, 0xAE5D'FF9C'0203'3197ULL,// 5^-211
+        0xA853'0886'B54D'BDEBULL, 0xD9F5'7F83'0283'FDFCULL,// 5^-210
+        0xD267'CAA8'62A1'2D66ULL, 0xD072'DF63'C324'FD7BULL,// 5^-209
+        0x8380'DEA9'3DA4'BC60ULL, 0x4247'CB9E'59F7'1E6DULL,// 5^-208
+        0xA461'1653'8D0D'EB78ULL, 0x52D9'BE85'F074'E608ULL,// 5^-207
+        0xCD79'5BE8'7051'6656ULL, 0x6790'2E27'6C92'1F8BULL,// 5^-206
+        0x806B'D971'4632'DFF6ULL, 0x00BA'1CD8'A3DB'53B6ULL,// 5^-205
+        0xA086'CFCD'97BF'97F3ULL, 0x80E8'A40E'CCD2'28A4ULL,// 5^-204
+        0xC8A8'83C0'FDAF'7DF0ULL, 0x6122'CD12'8006'B2CDULL,// 5^-203
+        0xFAD2'A4B1'3D1B'5D6CULL, 0x796B'8057'2008'5F81ULL,// 5^-202
+        0x9CC3'A6EE'C631'1A63ULL, 0xCBE3'3036'7405'3BB0ULL,// 5^-201
+        0xC3F4'90AA'77BD'60FCULL, 0xBEDB'FC44'1106'8A9CULL,// 5^-200
+        0xF4F1'B4D5'15AC'B93BULL, 0xEE92'FB55'1548'2D44ULL,// 5^-199
+        0x9917'1105'2D8B'F3C5ULL, 0x751B'DD15'2D4D'1C4AULL,// 5^-198
+        0xBF5C'D546'78EE'F0B6ULL, 0xD262'D45A'78A0'635DULL,// 5^-197
+        0xEF34'0A98'172A'ACE4ULL, 0x86FB'8971'16C8'7C34ULL,// 5^-196
+        0x9580'869F'0E7A'AC0EULL, 0xD45D'35E6'AE3D'4DA0ULL,// 5^-195
+        0xBAE0'A846'D219'5712ULL, 0x8974'8360'59CC'A109ULL,// 5^-194
+        0xE998'D258'869F'ACD7ULL, 0x2BD1'A438'703F'C94BULL,// 5^-193
+        0x91FF'8377'5423'CC06ULL, 0x7B63'06A3'4627'DDCFULL,// 5^-192
+        0xB67F'6455'292C'BF08ULL, 0x1A3B'C84C'17B1'D542ULL,// 5^-191
+        0xE41F'3D6A'7377'EECAULL, 0x20CA'BA5F'1D9E'4A93ULL,// 5^-190
+        0x8E93'8662'882A'F53EULL, 0x547E'B47B'7282'EE9CULL,// 5^-189
+        0xB238'67FB'2A35'B28DULL, 0xE99E'619A'4F23'AA43ULL,// 5^-188
+        0xDEC6'81F9'F4C3'1F31ULL, 0x6405'FA00'E2EC'94D4ULL,// 5^-187
+        0x8B3C'113C'38F9'F37EULL, 0xDE83'BC40'8DD3'DD04ULL,// 5^-186
+        0xAE0B'158B'4738'705EULL, 0x9624'AB50'B148'D445ULL,// 5^-185
+        0xD98D'DAEE'1906'8C76ULL, 0x3BAD'D624'DD9B'0957ULL,// 5^-184
+        0x87F8'A8D4'CFA4'17C9ULL, 0xE54C'A5D7'0A80'E5D6ULL,// 5^-183
+        0xA9F6'D30A'038D'1DBCULL, 0x5E9F'CF4C'CD21'1F4CULL,// 5^-182
+        0xD474'87CC'8470'652BULL, 0x7647'C320'0069'671FULL,// 5^-181
+        0x84C8'D4DF'D2C6'3F3BULL, 0x29EC'D9F4'0041'E073ULL,// 5^-180
+        0xA5FB'0A17'C777'CF09ULL, 0xF468'1071'0052'5890ULL,// 5^-179
+        0xCF79'CC9D'B955'C2CCULL, 0x7182'148D'4066'EEB4ULL,// 5^-178
+        0x81AC'1FE2'93D5'99BFULL, 0xC6F1'4CD8'4840'5530ULL,// 5^-177
+        0xA217'27DB'38CB'002FULL, 0xB8AD'A00E'5A50'6A7CULL,// 5^-176
+        0xCA9C'F1D2'06FD'C03BULL, 0xA6D9'0811'F0E4'851CULL,// 5^-175
+        0xFD44'2E46'88BD'304AULL, 0x908F'4A16'6D1D'A663ULL,// 5^-174
+        0x9E4A'9CEC'1576'3E2EULL, 0x9A59'8E4E'0432'87FEULL,// 5^-173
+        0xC5DD'4427'1AD3'CDBAULL, 0x40EF'F1E1'853F'29FDULL,// 5^-172
+        0xF754'9530'E188'C128ULL, 0xD12B'EE59'E68E'F47CULL,// 5^-171
+        0x9A94'DD3E'8CF5'78B9ULL, 0x82BB'74F8'3019'58CEULL,// 5^-170
+        0xC13A'148E'3032'D6E7ULL, 0xE36A'5236'3C1F'AF01ULL,// 5^-169
+        0xF188'99B1'BC3F'8CA1ULL, 0xDC44'E6C3'CB27'9AC1ULL,// 5^-168
+        0x96F5'600F'15A7'B7E5ULL, 0x29AB'103A'5EF8'C0B9ULL,// 5^-167
+        0xBCB2'B812'DB11'A5DEULL, 0x7415'D448'F6B6'F0E7ULL,// 5^-166
+        0xEBDF'6617'91D6'0F56ULL, 0x111B'495B'3464'AD21ULL,// 5^-165
+        0x936B'9FCE'BB25'C995ULL, 0xCAB1'0DD9'00BE'EC34ULL,// 5^-164
+        0xB846'87C2'69EF'3BFBULL, 0x3D5D'514F'40EE'A742ULL,// 5^-163
+        0xE658'29B3'046B'0AFAULL, 0x0CB4'A5A3'112A'5112ULL,// 5^-162
+        0x8FF7'1A0F'E2C2'E6DCULL, 0x47F0'E785'EABA'72ABULL,// 5^-161
+        0xB3F4'E093'DB73'A093ULL, 0x59ED'2167'6569'0F56ULL,// 5^-160
+        0xE0F2'18B8'D250'88B8ULL, 0x3068'69C1'3EC3'532CULL,// 5^-159
+        0x8C97'4F73'8372'5573ULL, 0x1E41'4218'C73A'13FBULL,// 5^-158
+        0xAFBD'2350'644E'EACFULL, 0xE5D1'929E'F908'98FAULL,// 5^-157
+        0xDBAC'6C24'7D62'A583ULL, 0xDF45'F746'B74A'BF39ULL,// 5^-156
+        0x894B'C396'CE5D'A772ULL, 0x6B8B'BA8C'328E'B783ULL,// 5^-155
+        0xAB9E'B47C'81F5'114FULL, 0x066E'A92F'3F32'6564ULL,// 5^-154
+        0xD686'619B'A272'55A2ULL, 0xC80A'537B'0EFE'FEBDULL,// 5^-153
+        0x8613'FD01'4587'7585ULL, 0xBD06'742C'E95F'5F36ULL,// 5^-152
+        0xA798'FC41'96E9'52E7ULL, 0x2C48'1138'23B7'3704ULL,// 5^-151
+        0xD17F'3B51'FCA3'A7A0ULL, 0xF75A'1586'2CA5'04C5ULL,// 5^-150
+        0x82EF'8513'3DE6'48C4ULL, 0x9A98'4D73'DBE7'22FBULL,// 5^-149
+        0xA3AB'6658'0D5F'DAF5ULL, 0xC13E'60D0'D2E0'EBBAULL,// 5^-148
+        0xCC96'3FEE'10B7'D1B3ULL, 0x318D'F905'0799'26A8ULL,// 5^-147
+        0xFFBB'CFE9'94E5'C61FULL, 0xFDF1'7746'497F'7052ULL,// 5^-146
+        0x9FD5'61F1'FD0F'9BD3ULL, 0xFEB6'EA8B'EDEF'A633ULL,// 5^-145
+        0xC7CA'BA6E'7C53'82C8ULL, 0xFE64'A52E'E96B'8FC0ULL,// 5^-144
+        0xF9BD'690A'1B68'637BULL, 0x3DFD'CE7A'A3C6'73B0ULL,// 5^-143
+        0x9C16'61A6'5121'3E2DULL, 0x06BE'A10C'A65C'084EULL,// 5^-142
+        0xC31B'FA0F'E569'8DB8ULL, 0x486E'494F'CFF3'0A62ULL,// 5^-141
+        0xF3E2'F893'DEC3'F126ULL, 0x5A89'DBA3'C3EF'CCFAULL,// 5^-140
+        0x986D'DB5C'6B3A'76B7ULL, 0xF896'2946'5A75'E01CULL,// 5^-139
+        0xBE89'5233'8609'1465ULL, 0xF6BB'B397'F113'5823ULL,// 5^-138
+        0xEE2B'A6C0'678B'597FULL, 0x746A'A07D'ED58'2E2CULL,// 5^-137
+        0x94DB'4838'40B7'17EFULL, 0xA8C2'A44E'B457'1CDCULL,// 5^-136
+        0xBA12'1A46'50E4'DDEBULL, 0x92F3'4D62'616C'E413ULL,// 5^-135
+        0xE896'A0D7'E51E'1566ULL, 0x77B0'20BA'F9C8'1D17ULL,// 5^-134
+        0x915E'2486'EF32'CD60ULL, 0x0ACE'1474'DC1D'122EULL,// 5^-133
+        0xB5B5'ADA8'AAFF'80B8ULL, 0x0D81'9992'1324'56BAULL,// 5^-132
+        0xE323'1912'D5BF'60E6ULL, 0x10E1'FFF6'97ED'6C69ULL,// 5^-131
+        0x8DF5'EFAB'C597'9C8FULL, 0xCA8D'3FFA'1EF4'63C1ULL,// 5^-130
+        0xB173'6B96'B6FD'83B3ULL, 0xBD30'8FF8'A6B1'7CB2ULL,// 5^-129
+        0xDDD0'467C'64BC'E4A0ULL, 0xAC7C'B3F6'D05D'DBDEULL,// 5^-128
+        0x8AA2'2C0D'BEF6'0EE4ULL, 0x6BCD'F07A'423A'A96BULL,// 5^-127
+        0xAD4A'B711'2EB3'929DULL, 0x86C1'6C98'D2C9'53C6ULL,// 5^-126
+        0xD89D'64D5'7A60'7744ULL, 0xE871'C7BF'077B'A8B7ULL,// 5^-125
+        0x8762'5F05'6C7C'4A8BULL, 0x1147'1CD7'64AD'4972ULL,// 5^-124
+        0xA93A'F6C6'C79B'5D2DULL, 0xD598'E40D'3DD8'9BCFULL,// 5^-123
+        0xD389'B478'7982'3479ULL, 0x4AFF'1D10'8D4E'C2C3ULL,// 5^-122
+        0x8436'10CB'4BF1'60CBULL, 0xCEDF'722A'5851'39BAULL,// 5^-121
+        0xA543'94FE'1EED'B8FEULL, 0xC297'4EB4'EE65'8828ULL,// 5^-120
+        0xCE94'7A3D'A6A9'273EULL, 0x733D'2262'29FE'EA32ULL,// 5^-119
+        0x811C'CC66'8829'B887ULL, 0x0806'357D'5A3F'525FULL,// 5^-118
+        0xA163'FF80'2A34'26A8ULL, 0xCA07'C2DC'B0CF'26F7ULL,// 5^-117
+        0xC9BC'FF60'34C1'3052ULL, 0xFC89'B393'DD02'F0B5ULL,// 5^-116
+        0xFC2C'3F38'41F1'7C67ULL, 0xBBAC'2078'D443'ACE2ULL,// 5^-115
+        0x9D9B'A783'2936'EDC0ULL, 0xD54B'944B'84AA'4C0DULL,// 5^-114
+        0xC502'9163'F384'A931ULL, 0x0A9E'795E'65D4'DF11ULL,// 5^-113
+        0xF643'35BC'F065'D37DULL, 0x4D46'17B5'FF4A'16D5ULL,// 5^-112
+        0x99EA'0196'163F'A42EULL, 0x504B'CED1'BF8E'4E45ULL,// 5^-111
+        0xC064'81FB'9BCF'8D39ULL, 0xE45E'C286'2F71'E1D6ULL,// 5^-110
+        0xF07D'A27A'82C3'7088ULL, 0x5D76'7327'BB4E'5A4CULL,// 5^-109
+        0x964E'858C'91BA'2655ULL, 0x3A6A'07F8'D510'F86FULL,// 5^-108
+        0xBBE2'26EF'B628'AFEAULL, 0x8904'89F7'0A55'368BULL,// 5^-107
+        0xEADA'B0AB'A3B2'DBE5ULL, 0x2B45'AC74'CCEA'842EULL,// 5^-106
+        0x92C8'AE6B'464F'C96FULL, 0x3B0B'8BC9'0012'929DULL,// 5^-105
+        0xB77A'DA06'17E3'BBCBULL, 0x09CE'6EBB'4017'3744ULL,// 5^-104
+        0xE559'9087'9DDC'AABDULL, 0xCC42'0A6A'101D'0515ULL,// 5^-103
+        0x8F57'FA54'C2A9'EAB6ULL, 0x9FA9'4682'4A12'232DULL,// 5^-102
+        0xB32D'F8E9'F354'6564ULL, 0x4793'9822'DC96'ABF9ULL,// 5^-101
+        0xDFF9'7724'7029'7EBDULL, 0x5978'7E2B'93BC'56F7ULL,// 5^-100
+        0x8BFB'EA76'C619'EF36ULL, 0x57EB'4EDB'3C55'B65AULL,// 5^-99
+        0xAEFA'E514'77A0'6B03ULL, 0xEDE6'2292'0B6B'23F1ULL,// 5^-98
+        0xDAB9'9E59'9588'85C4ULL, 0xE95F'AB36'8E45'ECEDULL,// 5^-97
+        0x88B4'02F7'FD75'539BULL, 0x11DB'CB02'18EB'B414ULL,// 5^-96
+        0xAAE1'03B5'FCD2'A881ULL, 0xD652'BDC2'9F26'A119ULL,// 5^-95
+        0xD599'44A3'7C07'52A2ULL, 0x4BE7'6D33'46F0'495FULL,// 5^-94
+        0x857F'CAE6'2D84'93A5ULL, 0x6F70'A440'0C56'2DDBULL,// 5^-93
+        0xA6DF'BD9F'B8E5'B88EULL, 0xCB4C'CD50'0F6B'B952ULL,// 5^-92
+        0xD097'AD07'A71F'26B2ULL, 0x7E20'00A4'1346'A7A7ULL,// 5^-91
+        0x825E'CC24'C873'782FULL, 0x8ED4'0066'8C0C'28C8ULL,// 5^-90
+        0xA2F6'7F2D'FA90'563BULL, 0x7289'0080'2F0F'32FAULL,// 5^-89
+        0xCBB4'1EF9'7934'6BCAULL, 0x4F2B'40A0'3AD2'FFB9ULL,// 5^-88
+        0xFEA1'26B7'D781'86BCULL, 0xE2F6'10C8'4987'BFA8ULL,// 5^-87
+        0x9F24'B832'E6B0'F436ULL, 0x0DD9'CA7D'2DF4'D7C9ULL,// 5^-86
+        0xC6ED'E63F'A05D'3143ULL, 0x9150'3D1C'7972'0DBBULL,// 5^-85
+        0xF8A9'5FCF'8874'7D94ULL, 0x75A4'4C63'97CE'912AULL,// 5^-84
+        0x9B69'DBE1'B548'CE7CULL, 0xC986'AFBE'3EE1'1ABAULL,// 5^-83
+        0xC244'52DA'229B'021BULL, 0xFBE8'5BAD'CE99'6168ULL,// 5^-82
+        0xF2D5'6790'AB41'C2A2ULL, 0xFAE2'7299'423F'B9C3ULL,// 5^-81
+        0x97C5'60BA'6B09'19A5ULL, 0xDCCD'879F'C967'D41AULL,// 5^-80
+        0xBDB6'B8E9'05CB'600FULL, 0x5400'E987'BBC1'C920ULL,// 5^-79
+        0xED24'6723'473E'3813ULL, 0x2901'23E9'AAB2'3B68ULL,// 5^-78
+        0x9436'C076'0C86'E30BULL, 0xF9A0'B672'0AAF'6521ULL,// 5^-77
+        0xB944'7093'8FA8'9BCEULL, 0xF808'E40E'8D5B'3E69ULL,// 5^-76
+        0xE795'8CB8'7392'C2C2ULL, 0xB60B'1D12'30B2'0E04ULL,// 5^-75
+        0x90BD'77F3'483B'B9B9ULL, 0xB1C6'F22B'5E6F'48C2ULL,// 5^-74
+        0xB4EC'D5F0'1A4A'A828ULL, 0x1E38'AEB6'360B'1AF3ULL,// 5^-73
+        0xE228'0B6C'20DD'5232ULL, 0x25C6'DA63'C38D'E1B0ULL,// 5^-72
+        0x8D59'0723'948A'535FULL, 0x579C'487E'5A38'AD0EULL,// 5^-71
+        0xB0AF'48EC'79AC'E837ULL, 0x2D83'5A9D'F0C6'D851ULL,// 5^-70
+        0xDCDB'1B27'9818'2244ULL, 0xF8E4'3145'6CF8'8E65ULL,// 5^-69
+        0x8A08'F0F8'BF0F'156BULL, 0x1B8E'9ECB'641B'58FFULL,// 5^-68
+        0xAC8B'2D36'EED2'DAC5ULL, 0xE272'467E'3D22'2F3FULL,// 5^-67
+        0xD7AD'F884'AA87'9177ULL, 0x5B0E'D81D'CC6A'BB0FULL,// 5^-66
+        0x86CC'BB52'EA94'BAEAULL, 0x98E9'4712'9FC2'B4E9ULL,// 5^-65
+        0xA87F'EA27'A539'E9A5ULL, 0x3F23'98D7'47B3'6224ULL,// 5^-64
+        0xD29F'E4B1'8E88'640EULL, 0x8EEC'7F0D'19A0'3AADULL,// 5^-63
+        0x83A3'EEEE'F915'3E89ULL, 0x1953'CF68'3004'24ACULL,// 5^-62
+        0xA48C'EAAA'B75A'8E2BULL, 0x5FA8'C342'3C05'2DD7ULL,// 5^-61
+        0xCDB0'2555'6531'31B6ULL, 0x3792'F412'CB06'794DULL,// 5^-60
+        0x808E'1755'5F3E'BF11ULL, 0xE2BB'D88B'BEE4'0BD0ULL,// 5^-59
+        0xA0B1'9D2A'B70E'6ED6ULL, 0x5B6A'CEAE'AE9D'0EC4ULL,// 5^-58
+        0xC8DE'0475'64D2'0A8BULL, 0xF245'825A'5A44'5275ULL,// 5^-57
+        0xFB15'8592'BE06'8D2EULL, 0xEED6'E2F0'F0D5'6712ULL,// 5^-56
+        0x9CED'737B'B6C4'183DULL, 0x5546'4DD6'9685'606BULL,// 5^-55
+        0xC428'D05A'A475'1E4CULL, 0xAA97'E14C'3C26'B886ULL,// 5^-54
+        0xF533'0471'4D92'65DFULL, 0xD53D'D99F'4B30'66A8ULL,// 5^-53
+        0x993F'E2C6'D07B'7FABULL, 0xE546'A803'8EFE'4029ULL,// 5^-52
+        0xBF8F'DB78'849A'5F96ULL, 0xDE98'5204'72BD'D033ULL,// 5^-51
+        0xEF73'D256'A5C0'F77CULL, 0x963E'6685'8F6D'4440ULL,// 5^-50
+        0x95A8'6376'2798'9AADULL, 0xDDE7'0013'79A4'4AA8ULL,// 5^-49
+        0xBB12'7C53'B17E'C159ULL, 0x5560'C018'580D'5D52ULL,// 5^-48
+        0xE9D7'1B68'9DDE'71AFULL, 0xAAB8'F01E'6E10'B4A6ULL,// 5^-47
+        0x9226'7121'62AB'070DULL, 0xCAB3'9613'04CA'70E8ULL,// 5^-46
+        0xB6B0'0D69'BB55'C8D1ULL, 0x3D60'7B97'C5FD'0D22ULL,// 5^-45
+        0xE45C'10C4'2A2B'3B05ULL, 0x8CB8'9A7D'B77C'506AULL,// 5^-44
+        0x8EB9'8A7A'9A5B'04E3ULL, 0x77F3'608E'92AD'B242ULL,// 5^-43
+        0xB267'ED19'40F1'C61CULL, 0x55F0'38B2'3759'1ED3ULL,// 5^-42
+        0xDF01'E85F'912E'37A3ULL, 0x6B6C'46DE'C52F'6688ULL,// 5^-41
+        0x8B61'313B'BABC'E2C6ULL, 0x2323'AC4B'3B3D'A015ULL,// 5^-40
+        0xAE39'7D8A'A96C'1B77ULL, 0xABEC'975E'0A0D'081AULL,// 5^-39
+        0xD9C7'DCED'53C7'2255ULL, 0x96E7'BD35'8C90'4A21ULL,// 5^-38
+        0x881C'EA14'545C'7575ULL, 0x7E50'D641'77DA'2E54ULL,// 5^-37
+        0xAA24'2499'6973'92D2ULL, 0xDDE5'0BD1'D5D0'B9E9ULL,// 5^-36
+        0xD4AD'2DBF'C3D0'7787ULL, 0x955E'4EC6'4B44'E864ULL,// 5^-35
+        0x84EC'3C97'DA62'4AB4ULL, 0xBD5A'F13B'EF0B'113EULL,// 5^-34
+        0xA627'4BBD'D0FA'DD61ULL, 0xECB1'AD8A'EACD'D58EULL,// 5^-33
+        0xCFB1'1EAD'4539'94BAULL, 0x67DE'18ED'A581'4AF2ULL,// 5^-32
+        0x81CE'B32C'4B43'FCF4ULL, 0x80EA'CF94'8770'CED7ULL,// 5^-31
+        0xA242'5FF7'5E14'FC31ULL, 0xA125'8379'A94D'028DULL,// 5^-30
+        0xCAD2'F7F5'359A'3B3EULL, 0x096E'E458'13A0'4330ULL,// 5^-29
+        0xFD87'B5F2'8300'CA0DULL, 0x8BCA'9D6E'1888'53FCULL,// 5^-28
+        0x9E74'D1B7'91E0'7E48ULL, 0x775E'A264'CF55'347EULL,// 5^-27
+        0xC612'0625'7658'9DDAULL, 0x9536'4AFE'032A'819EULL,// 5^-26
+        0xF796'87AE'D3EE'C551ULL, 0x3A83'DDBD'83F5'2205ULL,// 5^-25
+        0x9ABE'14CD'4475'3B52ULL, 0xC492'6A96'7279'3543ULL,// 5^-24
+        0xC16D'9A00'9592'8A27ULL, 0x75B7'053C'0F17'8294ULL,// 5^-23
+        0xF1C9'0080'BAF7'2CB1ULL, 0x5324'C68B'12DD'6339ULL,// 5^-22
+        0x971D'A050'74DA'7BEEULL, 0xD3F6'FC16'EBCA'5E04ULL,// 5^-21
+        0xBCE5'0864'9211'1AEAULL, 0x88F4'BB1C'A6BC'F585ULL,// 5^-20
+        0xEC1E'4A7D'B695'61A5ULL, 0x2B31'E9E3'D06C'32E6ULL,// 5^-19
+        0x9392'EE8E'921D'5D07ULL, 0x3AFF'322E'6243'9FD0ULL,// 5^-18
+        0xB877'AA32'36A4'B449ULL, 0x09BE'FEB9'FAD4'87C3ULL,// 5^-17
+        0xE695'94BE'C44D'E15BULL, 0x4C2E'BE68'7989'A9B4ULL,// 5^-16
+        0x901D'7CF7'3AB0'ACD9ULL, 0x0F9D'3701'4BF6'0A11ULL,// 5^-15
+        0xB424'DC35'095C'D80FULL, 0x5384'84C1'9EF3'8C95ULL,// 5^-14
+        0xE12E'1342'4BB4'0E13ULL, 0x2865'A5F2'06B0'6FBAULL,// 5^-13
+        0x8CBC'CC09'6F50'88CBULL, 0xF93F'87B7'442E'45D4ULL,// 5^-12
+        0xAFEB'FF0B'CB24'AAFEULL, 0xF78F'69A5'1539'D749ULL,// 5^-11
+        0xDBE6'FECE'BDED'D5BEULL, 0xB573'440E'5A88'4D1CULL,// 5^-10
+        0x8970'5F41'36B4'A597ULL, 0x3168'0A88'F895'3031ULL,// 5^-9
+        0xABCC'7711'8461'CEFCULL, 0xFDC2'0D2B'36BA'7C3EULL,// 5^-8
+        0xD6BF'94D5'E57A'42BCULL, 0x3D32'9076'0469'1B4DULL,// 5^-7
+        0x8637'BD05'AF6C'69B5ULL, 0xA63F'9A49'C2C1'B110ULL,// 5^-6
+        0xA7C5'AC47'1B47'8423ULL, 0x0FCF'80DC'3372'1D54ULL,// 5^-5
+        0xD1B7'1758'E219'652BULL, 0xD3C3'6113'404E'A4A9ULL,// 5^-4
+        0x8312'6E97'8D4F'DF3BULL, 0x645A'1CAC'0831'26EAULL,// 5^-3
+        0xA3D7'0A3D'70A3'D70AULL, 0x3D70'A3D7'0A3D'70A4ULL,// 5^-2
+        0xCCCC'CCCC'CCCC'CCCCULL, 0xCCCC'CCCC'CCCC'CCCDULL,// 5^-1
+        0x8000'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^0
+        0xA000'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^1
+        0xC800'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^2
+        0xFA00'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^3
+        0x9C40'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^4
+        0xC350'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^5
+        0xF424'0000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^6
+        0x9896'8000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^7
+        0xBEBC'2000'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^8
+        0xEE6B'2800'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^9
+        0x9502'F900'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^10
+        0xBA43'B740'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^11
+        0xE8D4'A510'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^12
+        0x9184'E72A'0000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^13
+        0xB5E6'20F4'8000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^14
+        0xE35F'A931'A000'0000ULL, 0x0000'0000'0000'0000ULL,// 5^15
+        0x8E1B'C9BF'0400'0000ULL, 0x0000'0000'0000'0000ULL,// 5^16
+        0xB1A2'BC2E'C500'0000ULL, 0x0000'0000'0000'0000ULL,// 5^17
+        0xDE0B'6B3A'7640'0000ULL, 0x0000'0000'0000'0000ULL,// 5^18
+        0x8AC7'2304'89E8'0000ULL, 0x0000'0000'0000'0000ULL,// 5^19
+        0xAD78'EBC5'AC62'0000ULL, 0x0000'0000'0000'0000ULL,// 5^20
+        0xD8D7'26B7'177A'8000ULL, 0x0000'0000'0000'0000ULL,// 5^21
+        0x8786'7832'6EAC'9000ULL, 0x0000'0000'0000'0000ULL,// 5^22
+        0xA968'163F'0A57'B400ULL, 0x0000'0000'0000'0000ULL,// 5^23
+        0xD3C2'1BCE'CCED'A100ULL, 0x0000'0000'0000'0000ULL,// 5^24
+        0x8459'5161'4014'84A0ULL, 0x0000'0000'0000'0000ULL,// 5^25
+        0xA56F'A5B9'9019'A5C8ULL, 0x0000'0000'0000'0000ULL,// 5^26
+        0xCECB'8F27'F420'0F3AULL, 0x0000'0000'0000'0000ULL,// 5^27
+        0x813F'3978'F894'0984ULL, 0x4000'0000'0000'0000ULL,// 5^28
+        0xA18F'07D7'36B9'0BE5ULL, 0x5000'0000'0000'0000ULL,// 5^29
+        0xC9F2'C9CD'0467'4EDEULL, 0xA400'0000'0000'0000ULL,// 5^30
+        0xFC6F'7C40'4581'2296ULL, 0x4D00'0000'0000'0000ULL,// 5^31
+        0x9DC5'ADA8'2B70'B59DULL, 0xF020'0000'0000'0000ULL,// 5^32
+        0xC537'1912'364C'E305ULL, 0x6C28'0000'0000'0000ULL,// 5^33
+        0xF684'DF56'C3E0'1BC6ULL, 0xC732'0000'0000'0000ULL,// 5^34
+        0x9A13'0B96'3A6C'115CULL, 0x3C7F'4000'0000'0000ULL,// 5^35
+        0xC097'CE7B'C907'15B3ULL, 0x4B9F'1000'0000'0000ULL,// 5^36
+        0xF0BD'C21A'BB48'DB20ULL, 0x1E86'D400'0000'0000ULL,// 5^37
+        0x9676'9950'B50D'88F4ULL, 0x1314'4480'0000'0000ULL,// 5^38
+        0xBC14'3FA4'E250'EB31ULL, 0x17D9'55A0'0000'0000ULL,// 5^39
+        0xEB19'4F8E'1AE5'25FDULL, 0x5DCF'AB08'0000'0000ULL,// 5^40
+        0x92EF'D1B8'D0CF'37BEULL, 0x5AA1'CAE5'0000'0000ULL,// 5^41
+        0xB7AB'C627'0503'05ADULL, 0xF14A'3D9E'4000'0000ULL,// 5^42
+        0xE596'B7B0'C643'C719ULL, 0x6D9C'CD05'D000'0000ULL,// 5^43
+        0x8F7E'32CE'7BEA'5C6FULL, 0xE482'0023'A200'0000ULL,// 5^44
+        0xB35D'BF82'1AE4'F38BULL, 0xDDA2'802C'8A80'0000ULL,// 5^45
+        0xE035'2F62'A19E'306EULL, 0xD50B'2037'AD20'0000ULL,// 5^46
+        0x8C21'3D9D'A502'DE45ULL, 0x4526'F422'CC34'0000ULL,// 5^47
+        0xAF29'8D05'0E43'95D6ULL, 0x9670'B12B'7F41'0000ULL,// 5^48
+        0xDAF3'F046'51D4'7B4CULL, 0x3C0C'DD76'5F11'4000ULL,// 5^49
+        0x88D8'762B'F324'CD0FULL, 0xA588'0A69'FB6A'C800ULL,// 5^50
+        0xAB0E'93B6'EFEE'0053ULL, 0x8EEA'0D04'7A45'7A00ULL,// 5^51
+        0xD5D2'38A4'ABE9'8068ULL, 0x72A4'9045'98D6'D880ULL,// 5^52
+        0x85A3'6366'EB71'F041ULL, 0x47A6'DA2B'7F86'4750ULL,// 5^53
+        0xA70C'3C40'A64E'6C51ULL, 0x9990'90B6'5F67'D924ULL,// 5^54
+        0xD0CF'4B50'CFE2'0765ULL, 0xFFF4'B4E3'F741'CF6DULL,// 5^55
+        0x8281'8F12'81ED'449FULL, 0xBFF8'F10E'7A89'21A4ULL,// 5^56
+        0xA321'F2D7'2268'95C7ULL, 0xAFF7'2D52'192B'6A0DULL,// 5^57
+        0xCBEA'6F8C'EB02'BB39ULL, 0x9BF4'F8A6'9F76'4490ULL,// 5^58
+        0xFEE5'0B70'25C3'6A08ULL, 0x02F2'36D0'4753'D5B4ULL,// 5^59
+        0x9F4F'2726'179A'2245ULL, 0x01D7'6242'2C94'6590ULL,// 5^60
+        0xC722'F0EF'9D80'AAD6ULL, 0x424D'3AD2'B7B9'7EF5ULL,// 5^61
+        0xF8EB'AD2B'84E0'D58BULL, 0xD2E0'8987'65A7'DEB2ULL,// 5^62
+        0x9B93'4C3B'330C'8577ULL, 0x63CC'55F4'9F88'EB2FULL,// 5^63
+        0xC278'1F49'FFCF'A6D5ULL, 0x3CBF'6B71'C76B'25FBULL,// 5^64
+        0xF316'271C'7FC3'908AULL, 0x8BEF'464E'3945'EF7AULL,// 5^65
+        0x97ED'D871'CFDA'3A56ULL, 0x9775'8BF0'E3CB'B5ACULL,// 5^66
+        0xBDE9'4E8E'43D0'C8ECULL, 0x3D52'EEED'1CBE'A317ULL,// 5^67
+        0xED63'A231'D4C4'FB27ULL, 0x4CA7'AAA8'63EE'4BDDULL,// 5^68
+        0x945E'455F'24FB'1CF8ULL, 0x8FE8'CAA9'3E74'EF6AULL,// 5^69
+        0xB975'D6B6'EE39'E436ULL, 0xB3E2'FD53'8E12'2B44ULL,// 5^70
+        0xE7D3'4C64'A9C8'5D44ULL, 0x60DB'BCA8'7196'B616ULL,// 5^71
+        0x90E4'0FBE'EA1D'3A4AULL, 0xBC89'55E9'46FE'31CDULL,// 5^72
+        0xB51D'13AE'A4A4'88DDULL, 0x6BAB'AB63'98BD'BE41ULL,// 5^73
+        0xE264'589A'4DCD'AB14ULL, 0xC696'963C'7EED'2DD1ULL,// 5^74
+        0x8D7E'B760'70A0'8AECULL, 0xFC1E'1DE5'CF54'3CA2ULL,// 5^75
+        0xB0DE'6538'8CC8'ADA8ULL, 0x3B25'A55F'4329'4BCBULL,// 5^76
+        0xDD15'FE86'AFFA'D912ULL, 0x49EF'0EB7'13F3'9EBEULL,// 5^77
+        0x8A2D'BF14'2DFC'C7ABULL, 0x6E35'6932'6C78'4337ULL,// 5^78
+        0xACB9'2ED9'397B'F996ULL, 0x49C2'C37F'0796'5404ULL,// 5^79
+        0xD7E7'7A8F'87DA'F7FBULL, 0xDC33'745E'C97B'E906ULL,// 5^80
+        0x86F0'AC99'B4E8'DAFDULL, 0x69A0'28BB'3DED'71A3ULL,// 5^81
+        0xA8AC'D7C0'2223'11BCULL, 0xC408'32EA'0D68'CE0CULL,// 5^82
+        0xD2D8'0DB0'2AAB'D62BULL, 0xF50A'3FA4'90C3'0190ULL,// 5^83
+        0x83C7'088E'1AAB'65DBULL, 0x7926'67C6'DA79'E0FAULL,// 5^84
+        0xA4B8'CAB1'A156'3F52ULL, 0x5770'01B8'9118'5938ULL,// 5^85
+        0xCDE6'FD5E'09AB'CF26ULL, 0xED4C'0226'B55E'6F86ULL,// 5^86
+        0x80B0'5E5A'C60B'6178ULL, 0x544F'8158'315B'05B4ULL,// 5^87
+        0xA0DC'75F1'778E'39D6ULL, 0x6963'61AE'3DB1'C721ULL,// 5^88
+        0xC913'936D'D571'C84CULL, 0x03BC'3A19'CD1E'38E9ULL,// 5^89
+        0xFB58'7849'4ACE'3A5FULL, 0x04AB'48A0'4065'C723ULL,// 5^90
+        0x9D17'4B2D'CEC0'E47BULL, 0x62EB'0D64'283F'9C76ULL,// 5^91
+        0xC45D'1DF9'4271'1D9AULL, 0x3BA5'D0BD'324F'8394ULL,// 5^92
+        0xF574'6577'930D'6500ULL, 0xCA8F'44EC'7EE3'6479ULL,// 5^93
+        0x9968'BF6A'BBE8'5F20ULL, 0x7E99'8B13'CF4E'1ECBULL,// 5^94
+        0xBFC2'EF45'6AE2'76E8ULL, 0x9E3F'EDD8'C321'A67EULL,// 5^95
+        0xEFB3'AB16'C59B'14A2ULL, 0xC5CF'E94E'F3EA'101EULL,// 5^96
+        0x95D0'4AEE'3B80'ECE5ULL, 0xBBA1'F1D1'5872'4A12ULL,// 5^97
+        0xBB44'5DA9'CA61'281FULL, 0x2A8A'6E45'AE8E'DC97ULL,// 5^98
+        0xEA15'7514'3CF9'7226ULL, 0xF52D'09D7'1A32'93BDULL,// 5^99
+        0x924D'692C'A61B'E758ULL, 0x593C'2626'705F'9C56ULL,// 5^100
+        0xB6E0'C377'CFA2'E12EULL, 0x6F8B'2FB0'0C77'836CULL,// 5^101
+        0xE498'F455'C38B'997AULL, 0x0B6D'FB9C'0F95'6447ULL,// 5^102
+        0x8EDF'98B5'9A37'3FECULL, 0x4724'BD41'89BD'5EACULL,// 5^103
+        0xB297'7EE3'00C5'0FE7ULL, 0x58ED'EC91'EC2C'B657ULL,// 5^104
+        0xDF3D'5E9B'C0F6'53E1ULL, 0x2F29'67B6'6737'E3EDULL,// 5^105
+        0x8B86'5B21'5899'F46CULL, 0xBD79'E0D2'0082'EE74ULL,// 5^106
+        0xAE67'F1E9'AEC0'7187ULL, 0xECD8'5906'80A3'AA11ULL,// 5^107
+        0xDA01'EE64'1A70'8DE9ULL, 0xE80E'6F48'20CC'9495ULL,// 5^108
+        0x8841'34FE'9086'58B2ULL, 0x3109'058D'147F'DCDDULL,// 5^109
+        0xAA51'823E'34A7'EEDEULL, 0xBD4B'46F0'599F'D415ULL,// 5^110
+        0xD4E5'E2CD'C1D1'EA96ULL, 0x6C9E'18AC'7007'C91AULL,// 5^111
+        0x850F'ADC0'9923'329EULL, 0x03E2'CF6B'C604'DDB0ULL,// 5^112
+        0xA653'9930'BF6B'FF45ULL, 0x84DB'8346'B786'151CULL,// 5^113
+        0xCFE8'7F7C'EF46'FF16ULL, 0xE612'6418'6567'9A63ULL,// 5^114
+        0x81F1'4FAE'158C'5F6EULL, 0x4FCB'7E8F'3F60'C07EULL,// 5^115
+        0xA26D'A399'9AEF'7749ULL, 0xE3BE'5E33'0F38'F09DULL,// 5^116
+        0xCB09'0C80'01AB'551CULL, 0x5CAD'F5BF'D307'2CC5ULL,// 5^117
+        0xFDCB'4FA0'0216'2A63ULL, 0x73D9'732F'C7C8'F7F6ULL,// 5^118
+        0x9E9F'11C4'014D'DA7EULL, 0x2867'E7FD'DCDD'9AFAULL,// 5^119
+        0xC646'D635'01A1'511DULL, 0xB281'E1FD'5415'01B8ULL,// 5^120
+        0xF7D8'8BC2'4209'A565ULL, 0x1F22'5A7C'A91A'4226ULL,// 5^121
+        0x9AE7'5759'6946'075FULL, 0x3375'788D'E9B0'6958ULL,// 5^122
+        0xC1A1'2D2F'C397'8937ULL, 0x0052'D6B1'641C'83AEULL,// 5^123
+        0xF209'787B'B47D'6B84ULL, 0xC067'8C5D'BD23'A49AULL,// 5^124
+        0x9745'EB4D'50CE'6332ULL, 0xF840'B7BA'9636'46E0ULL,// 5^125
+        0xBD17'6620'A501'FBFFULL, 0xB650'E5A9'3BC3'D898ULL,// 5^126
+        0xEC5D'3FA8'CE42'7AFFULL, 0xA3E5'1F13'8AB4'CEBEULL,// 5^127
+        0x93BA'47C9'80E9'8CDFULL, 0xC66F'336C'36B1'0137ULL,// 5^128
+        0xB8A8'D9BB'E123'F017ULL, 0xB80B'0047'445D'4184ULL,// 5^129
+        0xE6D3'102A'D96C'EC1DULL, 0xA60D'C059'1574'91E5ULL,// 5^130
+        0x9043'EA1A'C7E4'1392ULL, 0x87C8'9837'AD68'DB2FULL,// 5^131
+        0xB454'E4A1'79DD'1877ULL, 0x29BA'BE45'98C3'11FBULL,// 5^132
+        0xE16A'1DC9'D854'5E94ULL, 0xF429'6DD6'FEF3'D67AULL,// 5^133
+        0x8CE2'529E'2734'BB1DULL, 0x1899'E4A6'5F58'660CULL,// 5^134
+        0xB01A'E745'B101'E9E4ULL, 0x5EC0'5DCF'F72E'7F8FULL,// 5^135
+        0xDC21'A117'1D42'645DULL, 0x7670'7543'F4FA'1F73ULL,// 5^136
+        0x8995'04AE'7249'7EBAULL, 0x6A06'494A'791C'53A8ULL,// 5^137
+        0xABFA'45DA'0EDB'DE69ULL, 0x0487'DB9D'1763'6892ULL,// 5^138
+        0xD6F8'D750'9292'D603ULL, 0x45A9'D284'5D3C'42B6ULL,// 5^139
+        0x865B'8692'5B9B'C5C2ULL, 0x0B8A'2392'BA45'A9B2ULL,// 5^140
+        0xA7F2'6836'F282'B732ULL, 0x8E6C'AC77'68D7'141EULL,// 5^141
+        0xD1EF'0244'AF23'64FFULL, 0x3207'D795'430C'D926ULL,// 5^142
+        0x8335'616A'ED76'1F1FULL, 0x7F44'E6BD'49E8'07B8ULL,// 5^143
+        0xA402'B9C5'A8D3'A6E7ULL, 0x5F16'206C'9C62'09A6ULL,// 5^144
+        0xCD03'6837'1308'90A1ULL, 0x36DB'A887'C37A'8C0FULL,// 5^145
+        0x8022'2122'6BE5'5A64ULL, 0xC249'4954'DA2C'9789ULL,// 5^146
+        0xA02A'A96B'06DE'B0FDULL, 0xF2DB'9BAA'10B7'BD6CULL,// 5^147
+        0xC835'53C5'C896'5D3DULL, 0x6F92'8294'94E5'ACC7ULL,// 5^148
+        0xFA42'A8B7'3ABB'F48CULL, 0xCB77'2339'BA1F'17F9ULL,// 5^149
+        0x9C69'A972'84B5'78D7ULL, 0xFF2A'7604'1453'6EFBULL,// 5^150
+        0xC384'13CF'25E2'D70DULL, 0xFEF5'1385'1968'4ABAULL,// 5^151
+        0xF465'18C2'EF5B'8CD1ULL, 0x7EB2'5866'5FC2'5D69ULL,// 5^152
+        0x98BF'2F79'D599'3802ULL, 0xEF2F'773F'FBD9'7A61ULL,// 5^153
+        0xBEEE'FB58'4AFF'8603ULL, 0xAAFB'550F'FACF'D8FAULL,// 5^154
+        0xEEAA'BA2E'5DBF'6784ULL, 0x95BA'2A53'F983'CF38ULL,// 5^155
+        0x952A'B45C'FA97'A0B2ULL, 0xDD94'5A74'7BF2'6183ULL,// 5^156
+        0xBA75'6174'393D'88DFULL, 0x94F9'7111'9AEE'F9E4ULL,// 5^157
+        0xE912'B9D1'478C'EB17ULL, 0x7A37'CD56'01AA'B85DULL,// 5^158
+        0x91AB'B422'CCB8'12EEULL, 0xAC62'E055'C10A'B33AULL,// 5^159
+        0xB616'A12B'7FE6'17AAULL, 0x577B'986B'314D'6009ULL,// 5^160
+        0xE39C'4976'5FDF'9D94ULL, 0xED5A'7E85'FDA0'B80BULL,// 5^161
+        0x8E41'ADE9'FBEB'C27DULL, 0x1458'8F13'BE84'7307ULL,// 5^162
+        0xB1D2'1964'7AE6'B31CULL, 0x596E'B2D8'AE25'8FC8ULL,// 5^163
+        0xDE46'9FBD'99A0'5FE3ULL, 0x6FCA'5F8E'D9AE'F3BBULL,// 5^164
+        0x8AEC'23D6'8004'3BEEULL, 0x25DE'7BB9'480D'5854ULL,// 5^165
+        0xADA7'2CCC'2005'4AE9ULL, 0xAF56'1AA7'9A10'AE6AULL,// 5^166
+        0xD910'F7FF'2806'9DA4ULL, 0x1B2B'A151'8094'DA04ULL,// 5^167
+        0x87AA'9AFF'7904'2286ULL, 0x90FB'44D2'F05D'0842ULL,// 5^168
+        0xA995'41BF'5745'2B28ULL, 0x353A'1607'AC74'4A53ULL,// 5^169
+        0xD3FA'922F'2D16'75F2ULL, 0x4288'9B89'9791'5CE8ULL,// 5^170
+        0x847C'9B5D'7C2E'09B7ULL, 0x6995'6135'FEBA'DA11ULL,// 5^171
+        0xA59B'C234'DB39'8C25ULL, 0x43FA'B983'7E69'9095ULL,// 5^172
+        0xCF02'B2C2'1207'EF2EULL, 0x94F9'67E4'5E03'F4BBULL,// 5^173
+        0x8161'AFB9'4B44'F57DULL, 0x1D1B'E0EE'BAC2'78F5ULL,// 5^174
+        0xA1BA'1BA7'9E16'32DCULL, 0x6462'D92A'6973'1732ULL,// 5^175
+        0xCA28'A291'859B'BF93ULL, 0x7D7B'8F75'03CF'DCFEULL,// 5^176
+        0xFCB2'CB35'E702'AF78ULL, 0x5CDA'7352'44C3'D43EULL,// 5^177
+        0x9DEF'BF01'B061'ADABULL, 0x3A08'8813'6AFA'64A7ULL,// 5^178
+        0xC56B'AEC2'1C7A'1916ULL, 0x088A'AA18'45B8'FDD0ULL,// 5^179
+        0xF6C6'9A72'A398'9F5BULL, 0x8AAD'549E'5727'3D45ULL,// 5^180
+        0x9A3C'2087'A63F'6399ULL, 0x36AC'54E2'F678'864BULL,// 5^181
+        0xC0CB'28A9'8FCF'3C7FULL, 0x8457'6A1B'B416'A7DDULL,// 5^182
+        0xF0FD'F2D3'F3C3'0B9FULL, 0x656D'44A2'A11C'51D5ULL,// 5^183
+        0x969E'B7C4'7859'E743ULL, 0x9F64'4AE5'A4B1'B325ULL,// 5^184
+        0xBC46'65B5'9670'6114ULL, 0x873D'5D9F'0DDE'1FEEULL,// 5^185
+        0xEB57'FF22'FC0C'7959ULL, 0xA90C'B506'D155'A7EAULL,// 5^186
+        0x9316'FF75'DD87'CBD8ULL, 0x09A7'F124'42D5'88F2ULL,// 5^187
+        0xB7DC'BF53'54E9'BECEULL, 0x0C11'ED6D'538A'EB2FULL,// 5^188
+        0xE5D3'EF28'2A24'2E81ULL, 0x8F16'68C8'A86D'A5FAULL,// 5^189
+        0x8FA4'7579'1A56'9D10ULL, 0xF96E'017D'6944'87BCULL,// 5^190
+        0xB38D'92D7'60EC'4455ULL, 0x37C9'81DC'C395'A9ACULL,// 5^191
+        0xE070'F78D'3927'556AULL, 0x85BB'E253'F47B'1417ULL,// 5^192
+        0x8C46'9AB8'43B8'9562ULL, 0x9395'6D74'78CC'EC8EULL,// 5^193
+        0xAF58'4166'54A6'BABBULL, 0x387A'C8D1'9700'27B2ULL,// 5^194
+        0xDB2E'51BF'E9D0'696AULL, 0x0699'7B05'FCC0'319EULL,// 5^195
+        0x88FC'F317'F222'41E2ULL, 0x441F'ECE3'BDF8'1F03ULL,// 5^196
+        0xAB3C'2FDD'EEAA'D25AULL, 0xD527'E81C'AD76'26C3ULL,// 5^197
+        0xD60B'3BD5'6A55'86F1ULL, 0x8A71'E223'D8D3'B074ULL,// 5^198
+        0x85C7'0565'6275'7456ULL, 0xF687'2D56'6784'4E49ULL,// 5^199
+        0xA738'C6BE'BB12'D16CULL, 0xB428'F8AC'0165'61DBULL,// 5^200
+        0xD106'F86E'69D7'85C7ULL, 0xE133'36D7'01BE'BA52ULL,// 5^201
+        0x82A4'5B45'0226'B39CULL, 0xECC0'0246'6117'3473ULL,// 5^202
+        0xA34D'7216'42B0'6084ULL, 0x27F0'02D7'F95D'0190ULL,// 5^203
+        0xCC20'CE9B'D35C'78A5ULL, 0x31EC'038D'F7B4'41F4ULL,// 5^204
+        0xFF29'0242'C833'96CEULL, 0x7E67'0471'75A1'5271ULL,// 5^205
+        0x9F79'A169'BD20'3E41ULL, 0x0F00'62C6'E984'D386ULL,// 5^206
+        0xC758'09C4'2C68'4DD1ULL, 0x52C0'7B78'A3E6'0868ULL,// 5^207
+        0xF92E'0C35'3782'6145ULL, 0xA770'9A56'CCDF'8A82ULL,// 5^208
+        0x9BBC'C7A1'42B1'7CCBULL, 0x88A6'6076'400B'B691ULL,// 5^209
+        0xC2AB'F989'935D'DBFEULL, 0x6ACF'F893'D00E'A435ULL,// 5^210
+        0xF356'F7EB'F835'52FEULL, 0x0583'F6B8'C412'4D43ULL,// 5^211
+        0x9816'5AF3'7B21'53DEULL, 0xC372'7A33'7A8B'704AULL,// 5^212
+        0xBE1B'F1B0'59E9'A8D6ULL, 0x744F'18C0'592E'4C5CULL,// 5^213
+        0xEDA2'EE1C'7064'130CULL, 0x1162'DEF0'6F79'DF73ULL,// 5^214
+        0x9485'D4D1'C63E'8BE7ULL, 0x8ADD'CB56'45AC'2BA8ULL,// 5^215
+        0xB9A7'4A06'37CE'2EE1ULL, 0x6D95'3E2B'D717'3692ULL,// 5^216
+        0xE811'1C87'C5C1'BA99ULL, 0xC8FA'8DB6'CCDD'0437ULL,// 5^217
+        0x910A'B1D4'DB99'14A0ULL, 0x1D9C'9892'400A'22A2ULL,// 5^218
+        0xB54D'5E4A'127F'59C8ULL, 0x2503'BEB6'D00C'AB4BULL,// 5^219
+        0xE2A0'B5DC'971F'303AULL, 0x2E44'AE64'840F'D61DULL,// 5^220
+        0x8DA4'71A9'DE73'7E24ULL, 0x5CEA'ECFE'D289'E5D2ULL,// 5^221
+        0xB10D'8E14'5610'5DADULL, 0x7425'A83E'872C'5F47ULL,// 5^222
+        0xDD50'F199'6B94'7518ULL, 0xD12F'124E'28F7'7719ULL,// 5^223
+        0x8A52'96FF'E33C'C92FULL, 0x82BD'6B70'D99A'AA6FULL,// 5^224
+        0xACE7'3CBF'DC0B'FB7BULL, 0x636C'C64D'1001'550BULL,// 5^225
+        0xD821'0BEF'D30E'FA5AULL, 0x3C47'F7E0'5401'AA4EULL,// 5^226
+        0x8714'A775'E3E9'5C78ULL, 0x65AC'FAEC'3481'0A71ULL,// 5^227
+        0xA8D9'D153'5CE3'B396ULL, 0x7F18'39A7'41A1'4D0DULL,// 5^228
+        0xD310'45A8'341C'A07CULL, 0x1EDE'4811'1209'A050ULL,// 5^229
+        0x83EA'2B89'2091'E44DULL, 0x934A'ED0A'AB46'0432ULL,// 5^230
+        0xA4E4'B66B'68B6'5D60ULL, 0xF81D'A84D'5617'853FULL,// 5^231
+        0xCE1D'E406'42E3'F4B9ULL, 0x3625'1260'AB9D'668EULL,// 5^232
+        0x80D2'AE83'E9CE'78F3ULL, 0xC1D7'2B7C'6B42'6019ULL,// 5^233
+        0xA107'5A24'E442'1730ULL, 0xB24C'F65B'8612'F81FULL,// 5^234
+        0xC949'30AE'1D52'9CFCULL, 0xDEE0'33F2'6797'B627ULL,// 5^235
+        0xFB9B'7CD9'A4A7'443CULL, 0x1698'40EF'017D'A3B1ULL,// 5^236
+        0x9D41'2E08'06E8'8AA5ULL, 0x8E1F'2895'60EE'864EULL,// 5^237
+        0xC491'798A'08A2'AD4EULL, 0xF1A6'F2BA'B92A'27E2ULL,// 5^238
+        0xF5B5'D7EC'8ACB'58A2ULL, 0xAE10'AF69'6774'B1DBULL,// 5^239
+        0x9991'A6F3'D6BF'1765ULL, 0xACCA'6DA1'E0A8'EF29ULL,// 5^240
+        0xBFF6'10B0'CC6E'DD3FULL, 0x17FD'090A'58D3'2AF3ULL,// 5^241
+        0xEFF3'94DC'FF8A'948EULL, 0xDDFC'4B4C'EF07'F5B0ULL,// 5^242
+        0x95F8'3D0A'1FB6'9CD9ULL, 0x4ABD'AF10'1564'F98EULL,// 5^243
+        0xBB76'4C4C'A7A4'440FULL, 0x9D6D'1AD4'1ABE'37F1ULL,// 5^244
+        0xEA53'DF5F'D18D'5513ULL, 0x84C8'6189'216D'C5EDULL,// 5^245
+        0x9274'6B9B'E2F8'552CULL, 0x32FD'3CF5'B4E4'9BB4ULL,// 5^246
+        0xB711'8682'DBB6'6A77ULL, 0x3FBC'8C33'221D'C2A1ULL,// 5^247
+        0xE4D5'E823'92A4'0515ULL, 0x0FAB'AF3F'EAA5'334AULL,// 5^248
+        0x8F05'B116'3BA6'832DULL, 0x29CB'4D87'F2A7'400EULL,// 5^249
+        0xB2C7'1D5B'CA90'23F8ULL, 0x743E'20E9'EF51'1012ULL,// 5^250
+        0xDF78'E4B2'BD34'2CF6ULL, 0x914D'A924'6B25'5416ULL,// 5^251
+        0x8BAB'8EEF'B640'9C1AULL, 0x1AD0'89B6'C2F7'548EULL,// 5^252
+        0xAE96'72AB'A3D0'C320ULL, 0xA184'AC24'73B5'29B1ULL,// 5^253
+        0xDA3C'0F56'8CC4'F3E8ULL, 0xC9E5'D72D'90A2'741EULL,// 5^254
+        0x8865'8996'17FB'1871ULL, 0x7E2F'A67C'7A65'8892ULL,// 5^255
+        0xAA7E'EBFB'9DF9'DE8DULL, 0xDDBB'901B'98FE'EAB7ULL,// 5^256
+        0xD51E'A6FA'8578'5631ULL, 0x552A'7422'7F3E'A565ULL,// 5^257
+        0x8533'285C'936B'35DEULL, 0xD53A'8895'8F87'275FULL,// 5^258
+        0xA67F'F273'B846'0356ULL, 0x8A89'2ABA'F368'F137ULL,// 5^259
+        0xD01F'EF10'A657'842CULL, 0x2D2B'7569'B043'2D85ULL,// 5^260
+        0x8213'F56A'67F6'B29BULL, 0x9C3B'2962'0E29'FC73ULL,// 5^261
+        0xA298'F2C5'01F4'5F42ULL, 0x8349'F3BA'91B4'7B8FULL,// 5^262
+        0xCB3F'2F76'4271'7713ULL, 0x241C'70A9'3621'9A73ULL,// 5^263
+        0xFE0E'FB53'D30D'D4D7ULL, 0xED23'8CD3'83AA'0110ULL,// 5^264
+        0x9EC9'5D14'63E8'A506ULL, 0xF436'3804'324A'40AAULL,// 5^265
+        0xC67B'B459'7CE2'CE48ULL, 0xB143'C605'3EDC'D0D5ULL,// 5^266
+        0xF81A'A16F'DC1B'81DAULL, 0xDD94'B786'8E94'050AULL,// 5^267
+        0x9B10'A4E5'E991'3128ULL, 0xCA7C'F2B4'191C'8326ULL,// 5^268
+        0xC1D4'CE1F'63F5'7D72ULL, 0xFD1C'2F61'1F63'A3F0ULL,// 5^269
+        0xF24A'01A7'3CF2'DCCFULL, 0xBC63'3B39'673C'8CECULL,// 5^270
+        0x976E'4108'8617'CA01ULL, 0xD5BE'0503'E085'D813ULL,// 5^271
+        0xBD49'D14A'A79D'BC82ULL, 0x4B2D'8644'D8A7'4E18ULL,// 5^272
+        0xEC9C'459D'5185'2BA2ULL, 0xDDF8'E7D6'0ED1'219EULL,// 5^273
+        0x93E1'AB82'52F3'3B45ULL, 0xCABB'90E5'C942'B503ULL,// 5^274
+        0xB8DA'1662'E7B0'0A17ULL, 0x3D6A'751F'3B93'6243ULL,// 5^275
+        0xE710'9BFB'A19C'0C9DULL, 0x0CC5'1267'0A78'3AD4ULL,// 5^276
+        0x906A'617D'4501'87E2ULL, 0x27FB'2B80'668B'24C5ULL,// 5^277
+        0xB484'F9DC'9641'E9DAULL, 0xB1F9'F660'802D'EDF6ULL,// 5^278
+        0xE1A6'3853'BBD2'6451ULL, 0x5E78'73F8'A039'6973ULL,// 5^279
+        0x8D07'E334'5563'7EB2ULL, 0xDB0B'487B'6423'E1E8ULL,// 5^280
+        0xB049'DC01'6ABC'5E5FULL, 0x91CE'1A9A'3D2C'DA62ULL,// 5^281
+        0xDC5C'5301'C56B'75F7ULL, 0x7641'A140'CC78'10FBULL,// 5^282
+        0x89B9'B3E1'1B63'29BAULL, 0xA9E9'04C8'7FCB'0A9DULL,// 5^283
+        0xAC28'20D9'623B'F429ULL, 0x5463'45FA'9FBD'CD44ULL,// 5^284
+        0xD732'290F'BACA'F133ULL, 0xA97C'1779'47AD'4095ULL,// 5^285
+        0x867F'59A9'D4BE'D6C0ULL, 0x49ED'8EAB'CCCC'485DULL,// 5^286
+        0xA81F'3014'49EE'8C70ULL, 0x5C68'F256'BFFF'5A74ULL,// 5^287
+        0xD226'FC19'5C6A'2F8CULL, 0x7383'2EEC'6FFF'3111ULL,// 5^288
+        0x8358'5D8F'D9C2'5DB7ULL, 0xC831'FD53'C5FF'7EABULL,// 5^289
+        0xA42E'74F3'D032'F525ULL, 0xBA3E'7CA8'B77F'5E55ULL,// 5^290
+        0xCD3A'1230'C43F'B26FULL, 0x28CE'1BD2'E55F'35EBULL,// 5^291
+        0x8044'4B5E'7AA7'CF85ULL, 0x7980'D163'CF5B'81B3ULL,// 5^292
+        0xA055'5E36'1951'C366ULL, 0xD7E1'05BC'C332'621FULL,// 5^293
+        0xC86A'B5C3'9FA6'3440ULL, 0x8DD9'472B'F3FE'FAA7ULL,// 5^294
+        0xFA85'6334'878F'C150ULL, 0xB14F'98F6'F0FE'B951ULL,// 5^295
+        0x9C93'5E00'D4B9'D8D2ULL, 0x6ED1'BF9A'569F'33D3ULL,// 5^296
+        0xC3B8'3581'09E8'4F07ULL, 0x0A86'2F80'EC47'00C8ULL,// 5^297
+        0xF4A6'42E1'4C62'62C8ULL, 0xCD27'BB61'2758'C0FAULL,// 5^298
+        0x98E7'E9CC'CFBD'7DBDULL, 0x8038'D51C'B897'789CULL,// 5^299
+        0xBF21'E440'03AC'DD2CULL, 0xE047'0A63'E6BD'56C3ULL,// 5^300
+        0xEEEA'5D50'0498'1478ULL, 0x1858'CCFC'E06C'AC74ULL,// 5^301
+        0x9552'7A52'02DF'0CCBULL, 0x0F37'801E'0C43'EBC8ULL,// 5^302
+        0xBAA7'18E6'8396'CFFDULL, 0xD305'6025'8F54'E6BAULL,// 5^303
+        0xE950'DF20'247C'83FDULL, 0x47C6'B82E'F32A'2069ULL,// 5^304
+        0x91D2'8B74'16CD'D27EULL, 0x4CDC'331D'57FA'5441ULL,// 5^305
+        0xB647'2E51'1C81'471DULL, 0xE013'3FE4'ADF8'E952ULL,// 5^306
+        0xE3D8'F9E5'63A1'98E5ULL, 0x5818'0FDD'D977'23A6ULL,// 5^307
+        0x8E67'9C2F'5E44'FF8FULL, 0x570F'09EA'A7EA'7648ULL,// 5^308
+    };
+}// namespace cerb::lex::number
+
+#endif /* CERBERUS_LEX_POWERS_OF_FIVE_HPP */
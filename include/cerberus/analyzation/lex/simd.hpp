@@ -0,0 +1,352 @@
+#ifndef CERBERUS_LEX_SIMD_HPP
+#define CERBERUS_LEX_SIMD_HPP
+
+#include <bit>
+#include <array>
+#include <type_traits>
+#include <cerberus/types.h>
+#include <cerberus/analyzation/lex/char.hpp>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#elif defined(__SSSE3__)
+#    include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#    include <emmintrin.h>
+#endif
+
+namespace cerb::lex::simd {
+    /**
+     * @brief set of ASCII characters for nibble lookup (PSHUFB): bit (high
+     * nibble) of low[low nibble] is set, if character is in the set. Characters
+     * after ASCII are never in it, so UTF-8 sequences are left for decoding
+     */
+    struct Lookup
+    {
+        std::array<u8, 16> low{};
+    };
+
+    template<typename Predicate>
+    CERBLIB_DECL auto make_lookup(Predicate &&contains) -> Lookup
+    {
+        Lookup result{};
+
+        CERBLIB_UNROLL_N(4)
+        for (size_t chr = 0; chr != 0x80; ++chr) {
+            if (contains(chr)) {
+                result.low[chr & 0xFU] |= static_cast<u8>(1U << (chr >> 4U));
+            }
+        }
+
+        return result;
+    }
+
+#if defined(__AVX2__)
+    using mask_t           = u32;
+    constexpr size_t width = 32;
+    constexpr bool lookup  = true;
+
+    struct Block
+    {
+        __m256i data;
+
+        static auto load(const void *pointer) -> Block
+        {
+            return { _mm256_loadu_si256(static_cast<const __m256i *>(pointer)) };
+        }
+
+        [[nodiscard]] auto equal(u8 value) const -> mask_t
+        {
+            return static_cast<mask_t>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(data, _mm256_set1_epi8(static_cast<char>(value)))));
+        }
+
+        // bytes are compared as unsigned values
+        [[nodiscard]] auto at_least(u8 value) const -> mask_t
+        {
+            auto bound = _mm256_set1_epi8(static_cast<char>(value));
+            return static_cast<mask_t>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_max_epu8(data, bound), data)));
+        }
+
+        // shuffle works in 128-bit lanes, so tables are repeated in both
+        [[nodiscard]] auto in(const Lookup &set) const -> mask_t
+        {
+            auto nibble = _mm256_set1_epi8(0x0F);
+            auto low    = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(set.low.data())));
+            auto high = _mm256_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16,
+                32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+            auto bits = _mm256_and_si256(
+                _mm256_shuffle_epi8(low, _mm256_and_si256(data, nibble)),
+                _mm256_shuffle_epi8(
+                    high, _mm256_and_si256(_mm256_srli_epi16(data, 4), nibble)));
+
+            return ~static_cast<mask_t>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(bits, _mm256_setzero_si256())));
+        }
+    };
+#elif defined(__SSE2__) || defined(_M_X64)
+    using mask_t           = u32;
+    constexpr size_t width = 16;
+#    if defined(__SSSE3__)
+    constexpr bool lookup = true;
+#    else
+    constexpr bool lookup = false;
+#    endif
+
+    struct Block
+    {
+        __m128i data;
+
+        static auto load(const void *pointer) -> Block
+        {
+            return { _mm_loadu_si128(static_cast<const __m128i *>(pointer)) };
+        }
+
+        [[nodiscard]] auto equal(u8 value) const -> mask_t
+        {
+            return static_cast<mask_t>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(data, _mm_set1_epi8(static_cast<char>(value)))));
+        }
+
+        [[nodiscard]] auto at_least(u8 value) const -> mask_t
+        {
+            auto bound = _mm_set1_epi8(static_cast<char>(value));
+            return static_cast<mask_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(data, bound), data)));
+        }
+
+#    if defined(__SSSE3__)
+        [[nodiscard]] auto in(const Lookup &set) const -> mask_t
+        {
+            auto nibble = _mm_set1_epi8(0x0F);
+            auto low    = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(set.low.data()));
+            auto high = _mm_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+            auto bits = _mm_and_si128(
+                _mm_shuffle_epi8(low, _mm_and_si128(data, nibble)),
+                _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(data, 4), nibble)));
+
+            return ~static_cast<mask_t>(
+                       _mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()))) &
+                   0xFFFFU;
+        }
+#    else
+        [[nodiscard]] auto in(const Lookup &set) const -> mask_t;
+#    endif
+    };
+#else
+    using mask_t           = u32;
+    constexpr size_t width = 0;
+    constexpr bool lookup  = false;
+
+    struct Block
+    {
+        static auto load(const void *pointer) -> Block;
+        [[nodiscard]] auto in(const Lookup &set) const -> mask_t;
+    };
+#endif
+
+    /**
+     * @brief simd is used only for byte characters and when the target has it
+     */
+    template<typename CharT>
+    constexpr bool enabled = width != 0 && sizeof(CharT) == 1;
+
+    /**
+     * @brief nibble lookup needs byte shuffle (SSSE3 or AVX2)
+     */
+    template<typename CharT>
+    constexpr bool lookup_enabled = enabled<CharT> && lookup;
+
+    CERBLIB_DECL auto full_mask() -> mask_t
+    {
+        return width == bitsizeof(mask_t) ? ~mask_t{ 0 }
+                                          : (mask_t{ 1 } << (width % 32)) - 1;
+    }
+
+    // bits, which are located after the highest bit of mask
+    CERBLIB_DECL auto bits_after_highest(mask_t mask) -> mask_t
+    {
+        mask_t highest = mask_t{ 1 } << (std::bit_width(mask) - 1);
+        return ~((highest << 1) - 1);
+    }
+
+    struct Span
+    {
+        size_t length{ 0 };       // number of skipped characters
+        size_t newlines{ 0 };     // number of '\n' among them
+        size_t line_begin{ 0 };   // index of the character after the last '\n'
+        size_t columns{ 0 };      // how many columns follow the last '\n'
+    };
+
+    /**
+     * @brief skips characters until @p char_stop (or @p block_stop for whole
+     * block) finds a stop character, counts new lines and columns on the way.
+     * Works with @p width bytes at once while the whole block is inside
+     * [first, last), the rest is done char by char. '\r' does not move the
+     * column as in DotItem::skip_comments_and_layout. Without @p CountLines
+     * only the length is found
+     */
+    template<
+        bool CountLines = true, typename CharT, typename BlockStop,
+        typename CharStop>
+    auto skip_span(
+        const CharT *first, const CharT *last, BlockStop &&block_stop,
+        CharStop &&char_stop) -> Span
+    {
+        Span span{};
+        const CharT *current = first;
+        size_t carriage      = 0;// '\r' after the last '\n'
+
+        if constexpr (enabled<CharT>) {
+            CERBLIB_UNROLL_N(1)
+            while (static_cast<size_t>(last - current) >= width) {
+                auto block  = Block::load(current);
+                mask_t stop = block_stop(block);
+
+                if constexpr (!CountLines) {
+                    if (stop != 0) {
+                        current += std::countr_zero(stop);
+                        span.length = static_cast<size_t>(current - first);
+                        return span;
+                    }
+
+                    current += width;
+                    continue;
+                }
+
+                mask_t skipped   = stop == 0 ? full_mask() : (stop & (~stop + 1)) - 1;
+                mask_t newlines  = block.equal('\n') & skipped;
+                mask_t carriages = block.equal('\r') & skipped;
+                auto offset      = static_cast<size_t>(current - first);
+
+                if (newlines != 0) {
+                    auto last_newline = static_cast<size_t>(std::bit_width(newlines));
+                    span.newlines += static_cast<size_t>(std::popcount(newlines));
+                    span.line_begin = offset + last_newline;
+                    carriage        = static_cast<size_t>(
+                        std::popcount(carriages & bits_after_highest(newlines)));
+                } else {
+                    carriage += static_cast<size_t>(std::popcount(carriages));
+                }
+
+                if (stop != 0) {
+                    current += std::countr_zero(stop);
+                    span.length  = static_cast<size_t>(current - first);
+                    span.columns = span.length - span.line_begin - carriage;
+                    return span;
+                }
+
+                current += width;
+            }
+        }
+
+        for (; current != last && !char_stop(*current); ++current) {
+            if constexpr (!CountLines) {
+                continue;
+            }
+
+            if (*current == static_cast<CharT>('\n')) {
+                ++span.newlines;
+                span.line_begin = static_cast<size_t>(current - first) + 1;
+                carriage        = 0;
+            } else if (*current == static_cast<CharT>('\r')) {
+                ++carriage;
+            }
+        }
+
+        span.length  = static_cast<size_t>(current - first);
+        span.columns = span.length - span.line_begin - carriage;
+        return span;
+    }
+
+    /**
+     * @brief number of characters at @p first, which are in @p set. Only whole
+     * blocks are counted, the rest of input is left for the caller
+     */
+    template<typename CharT>
+    auto count_in(const Lookup &set, const CharT *first, const CharT *last) -> size_t
+    {
+        const CharT *current = first;
+
+        if constexpr (lookup_enabled<CharT>) {
+            CERBLIB_UNROLL_N(1)
+            while (static_cast<size_t>(last - current) >= width) {
+                mask_t outside = ~Block::load(current).in(set) & full_mask();
+
+                if (outside != 0) {
+                    return static_cast<size_t>(current - first) +
+                           static_cast<size_t>(std::countr_zero(outside));
+                }
+
+                current += width;
+            }
+        }
+
+        return static_cast<size_t>(current - first);
+    }
+
+    /**
+     * @brief number of characters at @p first before the first of @p values.
+     * Only whole blocks are searched, the rest of input is left for the caller
+     */
+    template<typename CharT, typename... Values>
+    auto count_until(const CharT *first, const CharT *last, Values... values)
+        -> size_t
+    {
+        const CharT *current = first;
+
+        if constexpr (enabled<CharT>) {
+            CERBLIB_UNROLL_N(1)
+            while (static_cast<size_t>(last - current) >= width) {
+                auto block  = Block::load(current);
+                mask_t stop = (block.equal(static_cast<u8>(values)) | ...);
+
+                if (stop != 0) {
+                    return static_cast<size_t>(current - first) +
+                           static_cast<size_t>(std::countr_zero(stop));
+                }
+
+                current += width;
+            }
+        }
+
+        return static_cast<size_t>(current - first);
+    }
+
+    /**
+     * @brief skips layout, stops at the first character, which is not a layout
+     * (or at '\0')
+     */
+    template<bool CountLines = true, typename CharT>
+    auto skip_layout(const CharT *first, const CharT *last) -> Span
+    {
+        return skip_span<CountLines>(
+            first, last,
+            [](const auto &block) {
+                return block.at_least(static_cast<u8>(' ' + 1)) | block.equal(0);
+            },
+            [](CharT chr) { return !is_layout(chr); });
+    }
+
+    /**
+     * @brief skips everything until @p value, which is used to find the end of
+     * comments: '\n' or the first character of the multiline comment end
+     */
+    template<bool CountLines = true, typename CharT>
+    auto skip_until(const CharT *first, const CharT *last, CharT value) -> Span
+    {
+        return skip_span<CountLines>(
+            first, last,
+            [value](const auto &block) {
+                return block.equal(static_cast<u8>(value));
+            },
+            [value](CharT chr) { return chr == value; });
+    }
+}// namespace cerb::lex::simd
+
+#endif /* CERBERUS_LEX_SIMD_HPP */
@@ -0,0 +1,270 @@
+#ifndef CERBERUS_LEX_STREAM_HPP
+#define CERBERUS_LEX_STREAM_HPP
+
+#include <cerrno>
+#include <string>
+#include <istream>
+#include <stdexcept>
+#include <system_error>
+#include <cerberus/types.h>
+#include <cerberus/math.hpp>
+#include <cerberus/analyzation/lex/lex.hpp>
+
+#if __has_include(<unistd.h>)
+#    include <unistd.h>
+#    define CERBERUS_HAS_UNISTD 1
+#endif
+
+namespace cerb::lex {
+    /**
+     * @brief reads chunks from std::basic_istream
+     */
+    template<typename CharT>
+    struct StreamReader
+    {
+        std::basic_istream<CharT> &stream;
+
+        auto operator()(CharT *buffer, size_t size) -> size_t
+        {
+            stream.read(buffer, static_cast<std::streamsize>(size));
+
+            if (stream.bad()) {
+                throw std::runtime_error("Unable to read from stream");
+            }
+
+            return static_cast<size_t>(stream.gcount());
+        }
+    };
+
+#ifdef CERBERUS_HAS_UNISTD
+    /**
+     * @brief reads chunks from file descriptor (file, pipe or socket)
+     */
+    template<typename CharT>
+    struct FileDescriptorReader
+    {
+        int fd{ -1 };
+
+        auto operator()(CharT *buffer, size_t size) -> size_t
+        {
+            ssize_t count = 0;
+
+            do {
+                count = ::read(fd, buffer, size * sizeof(CharT));
+            } while (count < 0 && errno == EINTR);
+
+            if (count < 0) {
+                throw std::system_error(errno, std::generic_category(), "read");
+            }
+
+            return static_cast<size_t>(count) / sizeof(CharT);
+        }
+    };
+#endif
+
+    /**
+     * @brief lexes input, which is read by chunks, so only the current chunk and
+     * the unfinished token from the previous one are kept in memory.
+     * Token is returned only if at least @p lookahead characters follow it in
+     * the buffer (or the input is over), otherwise it is scanned again with the
+     * next chunk. So @p lookahead must not be less than the longest look ahead
+     * of the lexer (the longest terminal, for example). Tokens are valid until
+     * the next call of next_token
+     * @tparam Lexer lexer with next_token (for example TokenCollector<Lex4C<>>)
+     * @tparam Reader function, which fills buffer and returns number of read
+     * characters, 0 means end of input
+     */
+    template<typename Lexer, typename Reader>
+    class StreamLexer
+    {
+    public:
+        using parent     = typename Lexer::parent;
+        using token_t    = typename parent::token_t;
+        using string_t   = typename parent::string_t;
+        using position_t = typename parent::position_t;
+
+    private:
+        Lexer &m_lexer;
+        Reader m_reader;
+        string_t m_filename{};
+        string_t m_buffer{};
+        position_t m_position{};
+        size_t m_line{ 0 };  // beginning of line, where scanning continues
+        size_t m_input{ 0 }; // the first not consumed character
+        size_t m_chunk_size{ 0 };
+        size_t m_lookahead{ 0 };
+        bool m_end_of_input{ false };
+        bool m_started{ false };
+
+        auto read_chunk() -> void
+        {
+            size_t size = m_buffer.size();
+            m_buffer.resize(size + m_chunk_size);
+
+            // pipes may return less than asked, so chunk is filled until the end
+            CERBLIB_UNROLL_N(1)
+            for (size_t end = size + m_chunk_size; size != end;) {
+                size_t count = m_reader(m_buffer.data() + size, end - size);
+
+                if (count == 0) {
+                    m_end_of_input = true;
+                    break;
+                }
+
+                size += count;
+            }
+
+            m_buffer.resize(size);
+        }
+
+        /*
+         * drops consumed part of the buffer, reads next chunk and restarts the
+         * lexer from the last accepted token. The current line is kept only
+         * if it is not too long, so memory does not depend on the line length
+         */
+        auto refill() -> void
+        {
+            size_t first = cmov(m_input - m_line > m_chunk_size, m_input, m_line);
+
+            m_buffer.erase(0, first);
+            m_input -= first;
+            m_line = 0;
+
+            m_lexer.clear_literals();
+            read_chunk();
+            m_lexer.resume({ m_buffer.data(), m_buffer.size() }, m_input, m_position);
+        }
+
+        template<typename Checkpoint>
+        auto save_checkpoint(const Checkpoint &checkpoint) -> void
+        {
+            m_input         = static_cast<size_t>(checkpoint.input - m_buffer.data());
+            m_line          = static_cast<size_t>(checkpoint.line - m_buffer.data());
+            m_position      = checkpoint.position;
+        }
+
+        CERBLIB_DECL auto is_safe() const -> bool
+        {
+            if (m_end_of_input) {
+                return true;
+            }
+
+            if (m_lexer.finished()) {
+                return false;
+            }
+
+            auto checkpoint = m_lexer.checkpoint();
+            auto rest = static_cast<size_t>(
+                m_buffer.data() + m_buffer.size() - checkpoint.input);
+            return rest >= m_lookahead;
+        }
+
+        /*
+         * checks, that error may be caused by the end of buffer: unknown token
+         * goes until the end or literal is not closed before it
+         */
+        CERBLIB_DECL auto error_reaches_end() const -> bool
+        {
+            const auto *head  = m_lexer.head();
+            const auto &input = head->get_input();
+
+            if (input.empty() || head->isolate_token().end() == input.end()) {
+                return true;
+            }
+
+            auto separator = input[0];
+
+            if (separator != m_lexer.m_string_separator &&
+                separator != m_lexer.m_char_separator) {
+                return false;
+            }
+
+            for (size_t i = 1; i < input.size(); ++i) {
+                if (input[i] == separator) {
+                    return false;
+                }
+
+                i += cmov(input[i] == '\\', 1UL, 0UL);
+            }
+
+            return true;
+        }
+
+        /*
+         * returns false, if token or error may be cut by the end of buffer, so
+         * it must be scanned again with the next chunk. Layout and closed
+         * comments before it are not kept, so long runs of them are scanned once
+         */
+        auto try_scan(const token_t *&token) -> bool
+        {
+            try {
+                token = m_lexer.next_token();
+
+                if (token == nullptr || is_safe()) {
+                    return true;
+                }
+            } catch (...) {
+                if (m_end_of_input || !error_reaches_end()) {
+                    throw;
+                }
+            }
+
+            save_checkpoint(m_lexer.skipped());
+            return false;
+        }
+
+    public:
+        CERBLIB_DECL auto filename() const noexcept -> const string_t &
+        {
+            return m_filename;
+        }
+
+        /**
+         * @brief size of the buffer, it depends on the chunk size and on the
+         * longest token, but not on the size of input
+         */
+        CERBLIB_DECL auto buffer_size() const noexcept -> size_t
+        {
+            return m_buffer.size();
+        }
+
+        auto next_token() -> const token_t *
+        {
+            if (!m_started) {
+                m_started = true;
+                refill();
+            }
+
+            if (m_lexer.has_pending()) {
+                return m_lexer.next_token();
+            }
+
+            const token_t *token = nullptr;
+
+            // token may be longer than chunk, so buffer grows until it holds it
+            while (!try_scan(token)) {
+                refill();
+            }
+
+            save_checkpoint(m_lexer.checkpoint());
+            return token;
+        }
+
+        StreamLexer(
+            Lexer &lexer, Reader reader, string_t filename,
+            size_t chunk_size = 65536, size_t lookahead = 128)
+          : m_lexer(lexer), m_reader(std::move(reader)),
+            m_filename(std::move(filename)), m_chunk_size(chunk_size),
+            m_lookahead(lookahead)
+        {
+            if (chunk_size <= lookahead) {
+                throw std::invalid_argument("Chunk size must be greater than lookahead");
+            }
+
+            m_position.filename = { m_filename.data(), m_filename.size() };
+            m_buffer.reserve(chunk_size * 2);
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_STREAM_HPP */
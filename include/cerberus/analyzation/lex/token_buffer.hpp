@@ -0,0 +1,220 @@
+#ifndef CERBERUS_LEX_TOKEN_BUFFER_HPP
+#define CERBERUS_LEX_TOKEN_BUFFER_HPP
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <stdexcept>
+#include <cerberus/types.h>
+#include <cerberus/string_view.hpp>
+#include <cerberus/analyzation/lex/newline_index.hpp>
+
+namespace cerb::lex {
+    /**
+     * @brief tokens, which are stored as parallel arrays: offset, length, type and
+     * id of file (12 bytes per token). Token is given by TokenView with the same
+     * fields as Token has (repr and type), repr of string and char literals
+     * includes separators. Inputs of files must outlive the buffer, views must not
+     * outlive it
+     */
+    template<typename CharT, typename TokenType>
+    class TokenBuffer
+    {
+    public:
+        using string_view_t = basic_string_view<CharT>;
+
+        struct File
+        {
+            string_view_t name{};
+            string_view_t input{};
+            mutable std::optional<NewlineIndex<CharT>> newlines{};// built on demand
+        };
+
+        struct TokenView
+        {
+            string_view_t repr{};
+            TokenType type{};
+            u32 offset{ 0 };
+            u16 file{ 0 };
+            const TokenBuffer *buffer{ nullptr };
+
+            /**
+             * @brief line and column of token, like Token has them
+             */
+            CERBLIB_DECL auto pos() const -> PositionInFile<CharT>
+            {
+                return buffer->position_at(file, offset);
+            }
+        };
+
+        class iterator
+        {
+            const TokenBuffer *m_buffer{ nullptr };
+            size_t m_index{ 0 };
+
+        public:
+            using value_type      = TokenView;
+            using difference_type = std::ptrdiff_t;
+
+            CERBLIB_DECL auto operator*() const -> TokenView
+            {
+                return (*m_buffer)[m_index];
+            }
+
+            constexpr auto operator++() -> iterator &
+            {
+                ++m_index;
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> iterator
+            {
+                auto copy = *this;
+                ++m_index;
+                return copy;
+            }
+
+            CERBLIB_DECL auto operator==(const iterator &other) const -> bool
+            {
+                return m_index == other.m_index;
+            }
+
+            iterator() = default;
+
+            constexpr iterator(const TokenBuffer &buffer, size_t index)
+              : m_buffer(&buffer), m_index(index)
+            {}
+        };
+
+    private:
+        std::vector<u32> m_offsets{};
+        std::vector<u32> m_lengths{};
+        std::vector<u16> m_types{};
+        std::vector<u16> m_files{};
+        std::vector<File> m_sources{};
+
+        template<typename T>
+        static auto narrow(auto value, const char *message) -> T
+        {
+            if (static_cast<u64>(value) > std::numeric_limits<T>::max()) {
+                throw std::out_of_range(message);
+            }
+            return static_cast<T>(value);
+        }
+
+    public:
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_types.size();
+        }
+
+        CERBLIB_DECL auto empty() const noexcept -> bool
+        {
+            return m_types.empty();
+        }
+
+        CERBLIB_DECL auto offsets() const noexcept -> std::span<const u32>
+        {
+            return m_offsets;
+        }
+
+        CERBLIB_DECL auto lengths() const noexcept -> std::span<const u32>
+        {
+            return m_lengths;
+        }
+
+        CERBLIB_DECL auto types() const noexcept -> std::span<const u16>
+        {
+            return m_types;
+        }
+
+        CERBLIB_DECL auto files() const noexcept -> std::span<const u16>
+        {
+            return m_files;
+        }
+
+        CERBLIB_DECL auto file(u16 id) const -> const File &
+        {
+            return m_sources[id];
+        }
+
+        CERBLIB_DECL auto operator[](size_t index) const -> TokenView
+        {
+            const File &source = m_sources[m_files[index]];
+            return { { source.input.begin() + m_offsets[index], m_lengths[index] },
+                     static_cast<TokenType>(m_types[index]),
+                     m_offsets[index],
+                     m_files[index],
+                     this };
+        }
+
+        CERBLIB_DECL auto begin() const -> iterator
+        {
+            return { *this, 0 };
+        }
+
+        CERBLIB_DECL auto end() const -> iterator
+        {
+            return { *this, size() };
+        }
+
+        /**
+         * @brief line and column of @p offset in @p file, new lines of the file
+         * are indexed on the first request
+         */
+        auto position_at(u16 file, size_t offset) const -> PositionInFile<CharT>
+        {
+            const File &source = m_sources[file];
+
+            if (!source.newlines.has_value()) {
+                source.newlines.emplace(source.input, source.name);
+            }
+
+            return source.newlines->position(offset);
+        }
+
+        /**
+         * @brief line and column of token
+         */
+        auto position(size_t index) const -> PositionInFile<CharT>
+        {
+            return position_at(m_files[index], m_offsets[index]);
+        }
+
+        auto add_file(const string_view_t &name, const string_view_t &input) -> u16
+        {
+            narrow<u32>(input.size(), "File is too big for TokenBuffer");
+            m_sources.push_back({ name, input, std::nullopt });
+            return narrow<u16>(m_sources.size() - 1, "Too many files in TokenBuffer");
+        }
+
+        auto push_back(u16 file, size_t offset, size_t length, TokenType type) -> void
+        {
+            m_offsets.push_back(static_cast<u32>(offset));
+            m_lengths.push_back(static_cast<u32>(length));
+            m_types.push_back(narrow<u16>(type, "Token type does not fit in u16"));
+            m_files.push_back(file);
+        }
+
+        auto reserve(size_t count) -> void
+        {
+            m_offsets.reserve(count);
+            m_lengths.reserve(count);
+            m_types.reserve(count);
+            m_files.reserve(count);
+        }
+
+        auto clear() -> void
+        {
+            m_offsets.clear();
+            m_lengths.clear();
+            m_types.clear();
+            m_files.clear();
+            m_sources.clear();
+        }
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_LEX_TOKEN_BUFFER_HPP */
@@ -0,0 +1,164 @@
+#ifndef CERBERUS_LEX_UTF8_HPP
+#define CERBERUS_LEX_UTF8_HPP
+
+#include <array>
+#include <limits>
+#include <cerberus/pair.hpp>
+#include <cerberus/math.hpp>
+#include <cerberus/types.h>
+#include <cerberus/analyzation/lex/lex_string.hpp>
+
+namespace cerb::lex::utf8 {
+    constexpr u32 Invalid      = std::numeric_limits<u32>::max();
+    constexpr u32 MaxCodePoint = 0x10'FFFF;
+
+    using byte_range_t = Pair<u8, u8>;
+    using sequence_t   = std::array<byte_range_t, 4>;
+
+    CERBLIB_DECL auto length(u32 code_point) -> size_t
+    {
+        if (code_point < 0x80) {
+            return 1;
+        }
+        if (code_point < 0x800) {
+            return 2;
+        }
+        return code_point < 0x1'0000 ? 3 : 4;
+    }
+
+    CERBLIB_DECL auto encode(u32 code_point) -> std::array<u8, 4>
+    {
+        std::array<u8, 4> result{};
+        size_t size = length(code_point);
+
+        if (size == 1) {
+            result[0] = static_cast<u8>(code_point);
+            return result;
+        }
+
+        CERBLIB_UNROLL_N(4)
+        for (size_t i = size - 1; i != 0; --i) {
+            result[i] = static_cast<u8>(0x80U | (code_point & 0x3FU));
+            code_point >>= 6U;
+        }
+
+        result[0] = static_cast<u8>(((0xFF00U >> size) & 0xFFU) | code_point);
+        return result;
+    }
+
+    /**
+     * @brief decodes code point at @p first. Broken, overlong and surrogate
+     * sequences give one Invalid character, so lexer stops on them
+     * @return code point and number of its characters
+     */
+    template<typename CharT>
+    CERBLIB_DECL auto decode(const CharT *first, const CharT *last) -> Pair<u32, size_t>
+    {
+        constexpr std::array<u32, 5> min_values{ 0, 0, 0x80, 0x800, 0x1'0000 };
+
+        u32 lead    = to_unsigned(*first);
+        size_t size = 0;
+
+        if (lead < 0x80) {
+            return { lead, 1 };
+        }
+
+        if (lead >= 0xC2 && lead <= 0xF4) {
+            size = lead >= 0xF0 ? 4 : (lead >= 0xE0 ? 3 : 2);
+        }
+
+        if (size == 0 || static_cast<size_t>(last - first) < size) {
+            return { Invalid, 1 };
+        }
+
+        u32 result = lead & (0x7FU >> size);
+
+        CERBLIB_UNROLL_N(4)
+        for (size_t i = 1; i != size; ++i) {
+            u32 chr = to_unsigned(first[i]);
+
+            if ((chr & 0xC0U) != 0x80U) {
+                return { Invalid, 1 };
+            }
+
+            result = (result << 6U) | (chr & 0x3FU);
+        }
+
+        if (result < min_values[size] || result > MaxCodePoint ||
+            (result >= 0xD800 && result <= 0xDFFF)) {
+            return { Invalid, 1 };
+        }
+
+        return { result, size };
+    }
+
+    /**
+     * @brief splits code points [first, last] into sequences of byte ranges,
+     * so automaton on bytes can match them: every byte of sequence is taken
+     * from its range independently of others
+     * @param function is called with sequence and its length
+     */
+    template<typename Function>
+    constexpr auto for_each_sequence(u32 first, u32 last, Function &&function) -> void
+    {
+        last = cerb::min(last, MaxCodePoint);
+
+        if (first > last) {
+            return;
+        }
+
+        // surrogates can't be encoded
+        if (first <= 0xDFFF && last >= 0xD800) {
+            for_each_sequence(first, cerb::min(last, 0xD7FFU), function);
+            for_each_sequence(cerb::max(first, 0xE000U), last, function);
+            return;
+        }
+
+        // both ends must have the same length of encoding
+        CERBLIB_UNROLL_N(1)
+        for (u32 bound : { 0x7FU, 0x7FFU, 0xFFFFU }) {
+            if (first <= bound && last > bound) {
+                for_each_sequence(first, bound, function);
+                for_each_sequence(bound + 1, last, function);
+                return;
+            }
+        }
+
+        size_t size = length(first);
+
+        // bytes after the common prefix must cover their whole ranges
+        CERBLIB_UNROLL_N(1)
+        for (size_t i = 1; i < size; ++i) {
+            u32 mask = (1U << (6 * i)) - 1;
+
+            if ((first & ~mask) == (last & ~mask)) {
+                continue;
+            }
+
+            if ((first & mask) != 0) {
+                for_each_sequence(first, first | mask, function);
+                for_each_sequence((first | mask) + 1, last, function);
+                return;
+            }
+
+            if ((last & mask) != mask) {
+                for_each_sequence(first, (last & ~mask) - 1, function);
+                for_each_sequence(last & ~mask, last, function);
+                return;
+            }
+        }
+
+        auto lower = encode(first);
+        auto upper = encode(last);
+        sequence_t sequence{};
+
+        CERBLIB_UNROLL_N(4)
+        for (size_t i = 0; i != size; ++i) {
+            sequence[i] = { lower[i], upper[i] };
+        }
+
+        function(sequence, size);
+    }
+}// namespace cerb::lex::utf8
+
+#endif /* CERBERUS_LEX_UTF8_HPP */
@@ -0,0 +1,88 @@
+#ifndef CERBERUS_BUMP_ARENA_HPP
+#define CERBERUS_BUMP_ARENA_HPP
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <cerberus/types.h>
+#include <cerberus/math.hpp>
+
+namespace cerb {
+    /**
+     * @brief allocates objects one after another in big blocks. Memory is
+     * freed only all at once (clear or destructor), so pointers stay valid
+     * until then
+     * @tparam T trivial type to store
+     * @tparam BlockSize number of elements in one block
+     */
+    template<typename T, size_t BlockSize = 4096>
+    class BumpArena
+    {
+        static_assert(std::is_trivial_v<T>);
+
+        std::vector<std::unique_ptr<T[]>> m_blocks{};
+        T *m_current{ nullptr };
+        size_t m_available{ 0 };
+        size_t m_size{ 0 };
+
+    public:
+        /**
+         * @brief number of elements, which have been allocated since the last clear
+         */
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_size;
+        }
+
+        auto allocate(size_t count) -> T *
+        {
+            if (count > m_available) {
+                // big requests get their own block, so the current one is not wasted
+                size_t block_size = cerb::max(count, BlockSize);
+                m_blocks.push_back(std::make_unique_for_overwrite<T[]>(block_size));
+
+                if (block_size != BlockSize) {
+                    m_size += count;
+                    return m_blocks.back().get();
+                }
+
+                m_current   = m_blocks.back().get();
+                m_available = block_size;
+            }
+
+            T *result = m_current;
+            m_current += count;
+            m_available -= count;
+            m_size += count;
+            return result;
+        }
+
+        auto store(const T *data, size_t count) -> T *
+        {
+            T *result = allocate(count);
+            std::copy(data, data + count, result);
+            return result;
+        }
+
+        auto clear() -> void
+        {
+            m_blocks.clear();
+            m_current   = nullptr;
+            m_available = 0;
+            m_size      = 0;
+        }
+
+        BumpArena() = default;
+
+        BumpArena(const BumpArena &)     = delete;
+        BumpArena(BumpArena &&) noexcept = default;
+
+        auto operator=(const BumpArena &) -> BumpArena & = delete;
+        auto operator=(BumpArena &&) noexcept -> BumpArena & = default;
+
+        ~BumpArena() = default;
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_BUMP_ARENA_HPP */
@@ -22,18 +22,20 @@ namespace cerb {
 
 #if defined(__x86_64__)
         if (!std::is_constant_evaluated()) {
-            __asm__(
+            // pcmpistri writes position of '\0' into rcx
+            size_t offset = 0;
+
+            __asm__ __volatile__(
                 " mov $-16, %0                      \n"
                 " pxor %%xmm0, %%xmm0               \n"
                 "1:                                 \n"
                 " add $16, %0                       \n"
-                " pcmpistri $0x08, (%0,%1), %%xmm0  \n"
+                " pcmpistri $0x08, (%0,%2), %%xmm0  \n"
                 " jnz 1b                            \n"
-                " add %2, %0                        \n"
-                : "=a"(index)
-                : "d"(reinterpret_cast<size_t>(str)),
-                  "c"(reinterpret_cast<size_t>(str))
-                : "memory");
+                " add %1, %0                        \n"
+                : "=&a"(index), "=&c"(offset)
+                : "d"(reinterpret_cast<size_t>(str))
+                : "xmm0", "cc", "memory");
             return index;
         }
 #endif /* ARCH */
@@ -0,0 +1,82 @@
+#ifndef CERBERUS_WORKER_POOL_HPP
+#define CERBERUS_WORKER_POOL_HPP
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <cerberus/types.h>
+#include <cerberus/math.hpp>
+
+namespace cerb {
+    /**
+     * @brief fixed number of workers, which take jobs from the shared counter
+     * until all of them are done. The first exception thrown by a job is
+     * rethrown in the caller's thread after all workers have joined
+     */
+    class WorkerPool
+    {
+        size_t m_workers{ 1 };
+
+    public:
+        CERBLIB_DECL auto size() const noexcept -> size_t
+        {
+            return m_workers;
+        }
+
+        template<typename F>
+        auto run(size_t jobs, F &&function) const -> void
+        {
+            std::atomic<size_t> next_job{ 0 };
+            std::exception_ptr exception{ nullptr };
+            std::mutex exception_mutex{};
+
+            auto worker = [&]() {
+                CERBLIB_UNROLL_N(1)
+                for (size_t job = next_job++; job < jobs; job = next_job++) {
+                    try {
+                        function(job);
+                    } catch (...) {
+                        std::scoped_lock lock{ exception_mutex };
+
+                        if (exception == nullptr) {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+            };
+
+            size_t workers = cerb::min(m_workers, jobs);
+
+            if (workers <= 1) {
+                worker();
+            } else {
+                std::vector<std::thread> threads{};
+                threads.reserve(workers - 1);
+
+                CERBLIB_UNROLL_N(1)
+                for (size_t i = 1; i < workers; ++i) {
+                    threads.emplace_back(worker);
+                }
+
+                worker();
+
+                CERBLIB_UNROLL_N(1)
+                for (auto &thread : threads) {
+                    thread.join();
+                }
+            }
+
+            if (exception != nullptr) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        explicit WorkerPool(size_t workers = std::thread::hardware_concurrency())
+          : m_workers(cerb::max<size_t>(workers, 1UL))
+        {}
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_WORKER_POOL_HPP */
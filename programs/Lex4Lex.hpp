@@ -151,6 +151,7 @@ namespace cerb {
 
 #define Lex4LexTemplate                             \
     template<                                   \
+        typename Derived,                                   \
         typename CharT = char,                       \
         typename TokenType = Lex4LexItem,              \
         bool MayThrow = true,                        \
@@ -158,11 +159,12 @@ namespace cerb {
         bool AllowStringLiterals = true,             \
         bool AllowComments = true,                   \
         size_t MaxTerminals = 64,                  \
-        size_t MaxSize4Terminals = 4>
+        size_t MaxSize4Terminals = 4,             \
+        bool TrackPositions = true>
 
-#define Lex4LexDefinition(CLASS) CalculatorTemplate struct CLASS : public Lex4Lex<>
+#define Lex4LexDefinition(CLASS) CalculatorTemplate struct CLASS : public Lex4Lex<CLASS>
 
-#define Lex4LexAccess using Lex4Lex<>::parent;               \
+#define Lex4LexAccess(CLASS) using Lex4Lex<CLASS>::parent;               \
         using parent::head;                                                         \
         using item_t           = typename parent::item_t;                           \
         using storage_t        = typename parent::storage_t;                        \
@@ -173,14 +175,20 @@ namespace cerb {
         using string_view_t    = typename parent::string_view_t;                    \
         using string_checker_t = typename parent::string_checker_t;                 \
         using item_initializer  = typename parent::item_initializer;                \
+        using keyword_set_t    = typename parent::keyword_set_t;                    \
         using enum Lex4LexItem;
 
 Lex4LexTemplate
-struct Lex4Lex: public CERBERUS_LEX_PARENT_CLASS
+struct Lex4Lex: public CERBERUS_STATIC_LEX_PARENT_CLASS
 {
-    CERBERUS_LEX_PARENT_CLASS_ACCESS
+    CERBERUS_STATIC_LEX_PARENT_CLASS_ACCESS
     using enum Lex4LexItem;
 
+    static constexpr keyword_set_t keywords{
+        { "true"_sv, TRUE, 2 },
+        { "false"_sv, FALSE, 2 },
+    };
+
     constexpr Lex4Lex()
     : parent(
         '\"',
@@ -189,11 +197,10 @@ struct Lex4Lex: public CERBERUS_LEX_PARENT_CLASS
         CHAR,
         {
             { GENERALIZED, "#GENERALIZE"_sv, true, 2 },
-            { TRUE, "true"_sv, true, 2 },
-            { FALSE, "false"_sv, true, 2 },
             { INT, "[0-9]+"_sv, false, 7 },
             { IDENTIFIER, "[a-zA-Z_]+[a-zA-Z0-9_]*"_sv, false, 7 }
         },
+        keywords,
         {
             { 
                 { ASSIGN, '=' },
@@ -1,10 +1,16 @@
+#include <map>
+#include <algorithm>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <fmt/format.h>
 #include <fmt/color.h>
+#include <cerberus/deque.hpp>
 #include <cerberus/string_view.hpp>
+#include <cerberus/worker_pool.hpp>
 #include <cerberus/analyzation/lex/lex.hpp>
+#include <cerberus/analyzation/lex/mapped_source.hpp>
 #include "Lex4Lex.hpp"
 
 using namespace cerb::literals;
@@ -13,14 +19,16 @@ using namespace std::string_view_literals;
 
 enum Lex4LexMode : u32
 {
-    NORMAL,
-    GENERATE_YACC,
-    UPDATE_YACC,
+    NORMAL        = 0,
+    GENERATE_YACC = 1,
+    UPDATE_YACC   = 2,
+    GENERATE_DFA  = 4,
+    STATIC_LEXER  = 8,
 };
 
-Lex4LexTemplate struct Lex4LexImpl : Lex4Lex<>
+struct Lex4LexImpl final : Lex4Lex<Lex4LexImpl>
 {
-    using Lex4Lex<>::parent;
+    using Lex4Lex<Lex4LexImpl>::parent;
     using parent::head;
     using item_t           = typename parent::item_t;
     using storage_t        = typename parent::storage_t;
@@ -31,6 +39,10 @@ Lex4LexTemplate struct Lex4LexImpl : Lex4Lex<>
     using string_view_t    = typename parent::string_view_t;
     using string_checker_t = typename parent::string_checker_t;
     using item_initializer = typename parent::item_initializer;
+    using CharT            = char;
+    using TokenType        = Lex4LexItem;
+    using rule_item_t      = cerb::lex::DotItem<CharT, size_t, true, 0, false, false, 1, 1>;
+    using rule_keywords_t  = cerb::lex::KeywordSet<CharT, size_t>;
 
     using enum Lex4LexBlock;
     using enum Lex4LexItem;
@@ -423,7 +435,6 @@ private:
                     block.second.operators.size()) +
                     1);
 
-            CERBLIB_UNROLL_N(2)
             while (taken_powers.contains(power)) {
                 throw_if_can(
                     power < bitsizeof(u64),
@@ -571,6 +582,8 @@ private:
             static_cast<u32>(UPDATE_YACC)) {
             tokens_string.pop_back();
 
+            // jobs, which update the same yacc file, run one after another
+
             std::ifstream t(yacc_file);
             std::stringstream buffer{};
             buffer << t.rdbuf();
@@ -682,6 +695,9 @@ auto operator<<(T &os, {2} value) -> T &
 
     auto generate_defines_and_class_declaration() -> void
     {
+        bool static_lexer = (static_cast<u32>(mode) & static_cast<u32>(STATIC_LEXER)) ==
+                            static_cast<u32>(STATIC_LEXER);
+
         generated_string += fmt::format(
             R"(
 
@@ -697,7 +713,7 @@ namespace cerb {{
 }}
 
 #define {0}Template                             \
-    template<                                   \
+    template<{8}                                   \
         typename CharT = {1},                       \
         typename TokenType = {7},              \
         bool MayThrow = {2},                        \
@@ -705,11 +721,12 @@ namespace cerb {{
         bool AllowStringLiterals = {3},             \
         bool AllowComments = {4},                   \
         size_t MaxTerminals = {5},                  \
-        size_t MaxSize4Terminals = {6}>
+        size_t MaxSize4Terminals = {6},             \
+        bool TrackPositions = true>
 
-#define {0}Definition(CLASS) CalculatorTemplate struct CLASS : public {0}<>
+#define {0}Definition(CLASS) CalculatorTemplate struct CLASS : public {0}<{9}>
 
-#define {0}Access using {0}<>::parent;               \
+#define {0}Access{10} using {0}<{9}>::parent;               \
         using parent::head;                                                         \
         using item_t           = typename parent::item_t;                           \
         using storage_t        = typename parent::storage_t;                        \
@@ -720,12 +737,13 @@ namespace cerb {{
         using string_view_t    = typename parent::string_view_t;                    \
         using string_checker_t = typename parent::string_checker_t;                 \
         using item_initializer  = typename parent::item_initializer;                \
+        using keyword_set_t    = typename parent::keyword_set_t;                    \
         using enum {7};
 
 {0}Template
-struct {0}: public CERBERUS_LEX_PARENT_CLASS
+struct {0}: public {11}
 {{
-    CERBERUS_LEX_PARENT_CLASS_ACCESS
+    {11}_ACCESS
     using enum {7};
 )",
             m_directives["CLASS_NAME"].to_string(),
@@ -735,13 +753,117 @@ struct {0}: public CERBERUS_LEX_PARENT_CLASS
             m_directives["ALLOW_COMMENTS"].to_string(),
             m_directives["MAX_TERMINALS"].to_string(),
             m_directives["MAX_SIZE_FOR_TERMINAL"].to_string(),
-            m_name_of_items);
+            m_name_of_items,
+            cerb::cmov<std::string_view>(
+                static_lexer, "                                   \\\n        typename Derived,",
+                ""),
+            cerb::cmov<std::string_view>(static_lexer, "CLASS", ""),
+            cerb::cmov<std::string_view>(static_lexer, "(CLASS)", ""),
+            cerb::cmov<std::string_view>(
+                static_lexer, "CERBERUS_STATIC_LEX_PARENT_CLASS",
+                "CERBERUS_LEX_PARENT_CLASS"));
+    }
+
+    // initializer of terminals: single characters and strings
+    auto generate_terminals() -> std::string
+    {
+        std::string operators1{};
+        std::string operators2{};
+
+        operators1.reserve(512);
+        operators2.reserve(512);
+
+        for (auto &elem : m_blocks) {
+            CERBLIB_UNROLL_N(2)
+            for (const auto &i : elem.second.operators) {
+                if (i.c_name() == "STRING" || i.c_name() == "CHAR") {
+                    continue;
+                }
+
+                if (i.rule_size() == 1) {
+                    operators1 += fmt::format(
+                        "\n                {{ {}, {}\'{}\'{} }},",
+                        i.name(),
+                        m_directives["CHAR_PREFIX"].to_string(),
+                        i.rule(),
+                        m_directives["CHAR_POSTFIX"].to_string());
+                } else if (i.rule_size() > 1) {
+                    operators2 += fmt::format(
+                        "\n                {{ {}, {}\"{}\"{} }},",
+                        i.name(),
+                        m_directives["STRING_PREFIX"].to_string(),
+                        i.rule(),
+                        m_directives["STRING_POSTFIX"].to_string());
+                }
+            }
+        }
+
+        return "        {\n            { " + operators1 + "\n            },\n           {" +
+               operators2 + "\n           }\n        },\n";
+    }
+
+    /*
+     * words, which are taken whole by rules (identifiers), are hashed at
+     * compile time, like lexer does it with them in its constructor
+     */
+    auto generate_keywords() -> std::vector<size_t>
+    {
+        std::vector<rule_item_t> spans{};
+        std::vector<size_t> keyword_ids{};
+        std::string keywords_str{};
+
+        for (auto &block : m_blocks) {
+            CERBLIB_UNROLL_N(2)
+            for (const auto &elem : block.second.rules) {
+                auto rule = unescape(elem.rule());
+                spans.emplace_back(rule_item_t({ elem.id(),
+                                                 { rule.data(), rule.size() },
+                                                 false,
+                                                 static_cast<u32>(block.second.power) }));
+            }
+        }
+
+        for (auto &block : m_blocks) {
+            CERBLIB_UNROLL_N(2)
+            for (const auto &elem : block.second.words) {
+                auto rule = unescape(elem.rule());
+
+                if (keyword_ids.size() == rule_keywords_t::Capacity ||
+                    !rule_keywords_t::can_hold({ rule.data(), rule.size() }) ||
+                    !takes_whole(spans, { rule.data(), rule.size() })) {
+                    continue;
+                }
+
+                keyword_ids.push_back(elem.id());
+                keywords_str += fmt::format(
+                    "\n        {{ {}\"{}\"{}, {}, 2 }},",
+                    m_directives["STRING_PREFIX"].to_string(),
+                    elem.rule(),
+                    m_directives["STRING_POSTFIX"].to_string(),
+                    elem.name());
+            }
+        }
+
+        generated_string += fmt::format(
+            "\n    static constexpr keyword_set_t keywords{{{}\n    }};\n", keywords_str);
+        return keyword_ids;
+    }
+
+    static auto takes_whole(
+        const std::vector<rule_item_t> &spans, const cerb::basic_string_view<CharT> &word)
+        -> bool
+    {
+        return std::any_of(spans.begin(), spans.end(), [&word](const auto &item) {
+            return item.takes_whole(word);
+        });
     }
 
     auto generate_class_body(
         const string_view_t &char_enum_name, const string_view_t &string_enum_name)
         -> void
     {
+        auto keyword_ids = generate_keywords();
+
         generated_string += fmt::format(
             R"(
     constexpr {0}()
@@ -759,17 +881,18 @@ struct {0}: public CERBERUS_LEX_PARENT_CLASS
 
         std::string words_str{};
         std::string rules_str{};
-        std::string operators1{};
-        std::string operators2{};
 
         words_str.reserve(512);
         rules_str.reserve(512);
-        operators1.reserve(512);
-        operators2.reserve(512);
 
         for (auto &elem : m_blocks) {
             CERBLIB_UNROLL_N(2)
             for (const auto &i : elem.second.words) {
+                if (std::find(keyword_ids.begin(), keyword_ids.end(), i.id()) !=
+                    keyword_ids.end()) {
+                    continue;
+                }
+
                 words_str += fmt::format(
                     "\n            {{ {}, {}\"{}\"{}, true, 2 }},",
                     i.name(),
@@ -788,57 +911,238 @@ struct {0}: public CERBERUS_LEX_PARENT_CLASS
                     m_directives["STRING_POSTFIX"].to_string(),
                     elem.second.power);
             }
+        }
+
+        generated_string += words_str + rules_str;
+        generated_string.pop_back();
+        generated_string += "\n        },\n        keywords,\n";
+        generated_string += generate_terminals();
+        generated_string += fmt::format(
+            "        {3}\"{0}\",\n        {3}\"{1}\",\n        {3}\"{2}\"\n    ",
+            m_directives["SINGLE_LINE_COMMENT"].to_string(),
+            m_directives["MULTILINE_COMMENT_BEGIN"].to_string(),
+            m_directives["MULTILINE_COMMENT_END"].to_string(),
+            m_directives["STRING_PREFIX"].to_string());
+        generated_string += ")\n    {}";
+    }
+
+    static auto unescape(std::string_view str) -> std::string
+    {
+        std::string result{};
+        result.reserve(str.size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < str.size(); ++i) {
+            if (str[i] != '\\' || i + 1 == str.size()) {
+                result.push_back(str[i]);
+                continue;
+            }
 
+            switch (str[++i]) {
+            case 'n':
+                result.push_back('\n');
+                break;
+
+            case 't':
+                result.push_back('\t');
+                break;
+
+            case 'r':
+                result.push_back('\r');
+                break;
+
+            default:
+                result.push_back(str[i]);
+                break;
+            }
+        }
+        return result;
+    }
+
+    auto build_dfa() -> cerb::lex::DfaTables<size_t>
+    {
+        cerb::lex::DfaBuilder<CharT, size_t> builder{};
+        std::vector<rule_item_t> spans{};
+
+        for (auto &block : m_blocks) {
             CERBLIB_UNROLL_N(2)
-            for (const auto &i : elem.second.operators) {
-                if (i.c_name() == "STRING" || i.c_name() == "CHAR") {
+            for (const auto &elem : block.second.rules) {
+                if (elem.hidden()) {
                     continue;
                 }
 
-                if (i.rule_size() == 1) {
-                    operators1 += fmt::format(
-                        "\n                {{ {}, {}\'{}\'{} }},",
-                        i.name(),
-                        m_directives["CHAR_PREFIX"].to_string(),
-                        i.rule(),
-                        m_directives["CHAR_POSTFIX"].to_string());
-                } else if (i.rule_size() > 1) {
-                    operators2 += fmt::format(
-                        "\n                {{ {}, {}\"{}\"{} }},",
-                        i.name(),
-                        m_directives["STRING_PREFIX"].to_string(),
-                        i.rule(),
-                        m_directives["STRING_POSTFIX"].to_string());
+                auto rule = unescape(elem.rule());
+                spans.emplace_back(rule_item_t({ elem.id(),
+                                                 { rule.data(), rule.size() },
+                                                 false,
+                                                 static_cast<u32>(block.second.power) }));
+                builder.add_item(spans.back());
+            }
+
+            CERBLIB_UNROLL_N(2)
+            for (const auto &elem : block.second.operators) {
+                if (elem.c_name() == "STRING" || elem.c_name() == "CHAR") {
+                    continue;
                 }
+
+                auto rule = unescape(elem.rule());
+                builder.add_terminal(elem.id(), { rule.data(), rule.size() });
             }
         }
 
-        generated_string += words_str + rules_str;
-        generated_string.pop_back();
-        generated_string += "\n        },\n        {\n            { ";
-        generated_string += operators1;
+        for (auto &block : m_blocks) {
+            CERBLIB_UNROLL_N(2)
+            for (const auto &elem : block.second.words) {
+                auto rule = unescape(elem.rule());
+                cerb::basic_string_view<CharT> word{ rule.data(), rule.size() };
+
+                // keywords are taken from identifiers, so they end like them
+                if (takes_whole(spans, word)) {
+                    builder.add_word(word, elem.id(), 2);
+                } else {
+                    builder.add_item(rule_item_t({ elem.id(), word, true, 2 }));
+                }
+            }
+        }
 
-        generated_string += "\n            },\n           {";
-        generated_string += operators2;
+        return builder.build();
+    }
+
+    auto generate_dfa_tables() -> void
+    {
+        constexpr size_t ElemsOnLine = 16;
+        auto dfa                     = build_dfa();
+        std::map<size_t, std::string_view> names{};
+
+        for_each_rule(
+            [&](const auto &elem) { names.emplace(elem.second, elem.first); },
+            [&](auto /* unused */, const auto & /*block*/, const auto &elem) {
+                names.emplace(elem.id(), elem.name());
+            },
+            cerb::empty(), cerb::empty());
 
-        generated_string += "\n           }\n";
-        generated_string += "        },\n";
         generated_string += fmt::format(
-            "        {3}\"{0}\",\n        {3}\"{1}\",\n        {3}\"{2}\"\n    ",
+            "\n    static constexpr size_t dfa_states = {};\n"
+            "    static constexpr size_t dfa_columns = {};\n\n"
+            "    static constexpr std::array<u8, {}> dfa_classes{{",
+            dfa.size(), dfa.columns(), dfa.classes.table().size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < dfa.classes.table().size(); ++i) {
+            generated_string += cerb::cmov<std::string>(
+                i % ElemsOnLine == 0, "\n        ", " ");
+            generated_string += fmt::format("{},", dfa.classes[i]);
+        }
+
+        generated_string += fmt::format(
+            "\n    }};\n\n    static constexpr std::array<u16, {}> dfa_transitions{{",
+            dfa.transitions.size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < dfa.transitions.size(); ++i) {
+            generated_string += cerb::cmov<std::string>(
+                i % ElemsOnLine == 0, "\n        ", " ");
+            generated_string += fmt::format("{},", dfa.transitions[i]);
+        }
+
+        generated_string += fmt::format(
+            "\n    }};\n\n    static constexpr std::array<TokenType, {}> "
+            "dfa_accept{{",
+            dfa.size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < dfa.size(); ++i) {
+            generated_string += fmt::format(
+                "\n        {},",
+                cerb::cmov(
+                    dfa.priority[i] == cerb::lex::Dfa<size_t>::NotAccepting,
+                    "UNDEFINED"sv, names[dfa.accept[i]]));
+        }
+
+        generated_string += fmt::format(
+            "\n    }};\n\n    static constexpr std::array<TokenType, {}> "
+            "dfa_partial{{",
+            dfa.size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < dfa.size(); ++i) {
+            generated_string += fmt::format(
+                "\n        {},",
+                cerb::cmov(
+                    (dfa.flags[i] & cerb::lex::Dfa<size_t>::PartialFlag) == 0,
+                    "UNDEFINED"sv, names[dfa.partial[i]]));
+        }
+
+        generated_string += fmt::format(
+            "\n    }};\n\n    static constexpr std::array<u32, {}> dfa_priority{{",
+            dfa.size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < dfa.size(); ++i) {
+            generated_string += cerb::cmov<std::string>(
+                i % ElemsOnLine == 0, "\n        ", " ");
+            generated_string += fmt::format("{},", dfa.priority[i]);
+        }
+
+        generated_string += fmt::format(
+            "\n    }};\n\n    static constexpr std::array<u8, {}> dfa_flags{{",
+            dfa.size());
+
+        CERBLIB_UNROLL_N(2)
+        for (size_t i = 0; i < dfa.size(); ++i) {
+            generated_string += cerb::cmov<std::string>(
+                i % ElemsOnLine == 0, "\n        ", " ");
+            generated_string += fmt::format("{},", dfa.flags[i]);
+        }
+        generated_string += "\n    };\n";
+    }
+
+    auto generate_dfa_class_body(
+        const string_view_t &char_enum_name, const string_view_t &string_enum_name)
+        -> void
+    {
+        generate_dfa_tables();
+        generated_string += fmt::format(
+            R"(
+    constexpr {0}()
+    : parent(
+        {3}'{1}'{4},
+        {3}'{2}'{4},
+        {5},
+        {6},
+        {{ dfa_transitions.data(), dfa_classes.data(), dfa_columns,
+           dfa_accept.data(), dfa_partial.data(), dfa_priority.data(),
+           dfa_flags.data(), dfa_states }},
+{11}        {7}"{8}",
+        {7}"{9}",
+        {7}"{10}"
+    )
+    {{}})",
+            m_directives["CLASS_NAME"].to_string(),
+            m_directives["STRING"].to_string(), m_directives["CHAR"].to_string(),
+            m_directives["CHAR_PREFIX"].to_string(),
+            m_directives["CHAR_POSTFIX"].to_string(), string_enum_name.to_string(),
+            char_enum_name.to_string(),
+            m_directives["STRING_PREFIX"].to_string(),
             m_directives["SINGLE_LINE_COMMENT"].to_string(),
             m_directives["MULTILINE_COMMENT_BEGIN"].to_string(),
             m_directives["MULTILINE_COMMENT_END"].to_string(),
-            m_directives["STRING_PREFIX"].to_string());
-        generated_string += ")\n    {}";
+            generate_terminals());
     }
 
 public:
+    constexpr auto add_mode(Lex4LexMode new_mode) -> void
+    {
+        mode = static_cast<Lex4LexMode>(
+            static_cast<u32>(mode) | static_cast<u32>(new_mode));
+    }
+
     CERBLIB_DECL auto get_result() const noexcept -> const std::string &
     {
         return generated_string;
     }
 
-    constexpr auto yield(const token_t &token) -> bool override
+    constexpr auto yield(const token_t &token) -> bool
     {
         m_tokens.emplace_back(token);
 
@@ -897,13 +1201,13 @@ public:
     }
 
     constexpr auto error(const item_t &item, const string_view_t &repr)
-        -> void override
+        -> void
     {
         cerb::analysis::basic_lexical_error(
             item, repr, "Unable to find suitable dot item for: ");
     }
 
-    auto finish() -> void override
+    auto finish() -> void
     {
         string_view_t char_enum_name   = "CHAR";
         string_view_t string_enum_name = "STRING";
@@ -934,7 +1238,13 @@ public:
         generate_item_names();
         generate_converters_and_printers();
         generate_defines_and_class_declaration();
-        generate_class_body(char_enum_name, string_enum_name);
+
+        if ((static_cast<u32>(mode) & static_cast<u32>(GENERATE_DFA)) ==
+            static_cast<u32>(GENERATE_DFA)) {
+            generate_dfa_class_body(char_enum_name, string_enum_name);
+        } else {
+            generate_class_body(char_enum_name, string_enum_name);
+        }
     }
 
     Lex4LexImpl()
@@ -944,60 +1254,64 @@ public:
     }
 };
 
-auto generate_file(Lex4LexImpl<> &lex, std::string &filename) -> void
+auto generate_file(Lex4LexImpl &lex, std::string &filename) -> void
 {
     lex.filename = filename;
-    std::ifstream t(filename);
-    std::stringstream buffer{};
-    buffer << t.rdbuf();
-    t.close();
+    cerb::lex::MappedSource<char> source(filename);
 
-    std::string data = buffer.str();
-    size_t offset    = data.find_first_of("%%") + 2;
-    lex.scan(data.c_str() + offset, filename.c_str());
+    std::string_view data{ source.data(), source.size() };
+    size_t offset = data.find_first_of("%%") + 2;
+    lex.scan({ data.data() + offset, data.size() - offset }, filename.c_str());
 
-    std::string rest_class = data.substr(
-        static_cast<unsigned long>(lex.get_input().data() - data.c_str()));
-    std::string rest = rest_class.substr(rest_class.find_last_of("%%") + 2);
+    std::string_view rest_class = data.substr(
+        static_cast<unsigned long>(lex.get_input().data() - data.data()));
+    std::string_view rest = rest_class.substr(rest_class.find_last_of("%%") + 2);
 
-    rest_class.erase(rest_class.find("%%"));
-    data.erase(offset - 2);
+    rest_class = rest_class.substr(0, rest_class.find("%%"));
 
-    data.append(lex.get_result());
-    data.append(rest_class);
-    data.append("\n};\n");
-    data.append(rest);
+    std::string result{ data.substr(0, offset - 2) };
+    result.append(lex.get_result());
+    result.append(rest_class);
+    result.append("\n};\n");
+    result.append(rest);
 
     filename.erase(filename.find_last_of('.'));
     filename += ".hpp";
 
     std::ofstream out(filename);
-    out << data;
+    out << result;
     out.close();
 }
 
+struct Lex4LexJob
+{
+    u32 mode{ NORMAL };
+    std::string yacc_file{};
+    std::string filename{};
+};
+
 auto main(int argc, char *argv[]) -> int
 {
+    Lex4LexMode file_mode = NORMAL;
+    std::vector<Lex4LexJob> jobs{};
+
     CERBLIB_UNROLL_N(1)
     for (int i = 1; i < argc; ++i) {
-        Lex4LexImpl lex{};
-
         std::string filename = argv[i];
-        if (filename == "-YACC") {
-            lex.mode = GENERATE_YACC;
-            filename = argv[++i];
-            generate_file(lex, filename);
+
+        if (filename == "-DFA") {
+            file_mode = static_cast<Lex4LexMode>(file_mode | GENERATE_DFA);
+        } else if (filename == "-STATIC") {
+            file_mode = static_cast<Lex4LexMode>(file_mode | STATIC_LEXER);
+        } else if (filename == "-YACC") {
+            jobs.push_back({ file_mode | GENERATE_YACC, {}, argv[++i] });
         } else if (filename == "-UPDATE") {
-            lex.mode      = UPDATE_YACC;
-            lex.yacc_file = argv[++i];
-            filename      = argv[++i];
-            generate_file(lex, filename);
+            jobs.push_back({ file_mode | UPDATE_YACC, argv[i + 1], argv[i + 2] });
+            i += 2;
         } else if (filename == "-UPDATE+") {
-            lex.mode = static_cast<Lex4LexMode>(
-                static_cast<u32>(UPDATE_YACC) | static_cast<u32>(GENERATE_YACC));
-            lex.yacc_file = argv[++i];
-            filename      = argv[++i];
-            generate_file(lex, filename);
+            jobs.push_back({ file_mode | UPDATE_YACC | GENERATE_YACC, argv[i + 1],
+                             argv[i + 2] });
+            i += 2;
         } else if (filename == "-h" || filename == "--help") {
             fmt::print(
                 R"(Welcome to cerb4lex generator!
@@ -1008,12 +1322,46 @@ Available command:
     3) -UPDATE updates next file (yacc file) from second file (cerberus rule)
         yacc file must contain at least one %token and tokens must be written together in order not to cause any damage to the file
     4) -UPDATE+ UPDATE and YACC together
-    5) In normal mode cerb4lex generates header file from given rule
+    5) -DFA files after this flag are generated with precomputed DFA tables instead of rules
+    6) -STATIC lexers from files after this flag take derived class as the first template argument and call it without virtual functions
+    7) In normal mode cerb4lex generates header file from given rule
+Files are processed in parallel, one generator per file, files which update the same yacc file are processed in order.
 )");
         } else {
-            generate_file(lex, filename);
+            jobs.push_back({ file_mode, {}, filename });
         }
     }
 
+    // jobs with the same output (yacc file) run in order of arguments
+    std::vector<std::vector<size_t>> chains{};
+    std::map<std::string, size_t> chain_of_output{};
+
+    CERBLIB_UNROLL_N(1)
+    for (size_t i = 0; i != jobs.size(); ++i) {
+        const auto &output =
+            jobs[i].yacc_file.empty() ? jobs[i].filename : jobs[i].yacc_file;
+        auto [chain, inserted] = chain_of_output.try_emplace(output, chains.size());
+
+        if (inserted) {
+            chains.emplace_back();
+        }
+
+        chains[chain->second].push_back(i);
+    }
+
+    cerb::WorkerPool pool{};
+
+    pool.run(chains.size(), [&jobs, &chains](size_t index) {
+        CERBLIB_UNROLL_N(1)
+        for (size_t job_index : chains[index]) {
+            Lex4LexImpl lex{};
+            auto &job = jobs[job_index];
+
+            lex.mode      = static_cast<Lex4LexMode>(job.mode);
+            lex.yacc_file = job.yacc_file;
+            generate_file(lex, job.filename);
+        }
+    });
+
     return 0;
-}
\ No newline at end of file
+}